@@ -14,6 +14,7 @@
 #include "G4UIcmdWithoutParameter.hh"
 #include "G4UIcmdWithAString.hh"
 #include "G4UImessenger.hh"
+#include "G4Types.hh"
 
 namespace ldmx { 
 
@@ -83,8 +84,11 @@ namespace ldmx {
             /** Flag indicating if biasing is enabled */
             static bool biasingEnabled_;
 
-            /** Event weight corrected to account for biased cross-section. */
-            static double eventWeight_;
+            /** 
+             * Event weight corrected to account for biased cross-section.
+             * This is set during event processing so each thread keeps its own.
+             */
+            static G4ThreadLocal double eventWeight_;
 
             /** Particle specifies to bias. */
             static std::string particleType_;
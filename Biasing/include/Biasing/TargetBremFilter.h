@@ -99,7 +99,7 @@ namespace ldmx {
             /**
              *
              */
-            static std::vector<G4Track*> getBremGammaList() { return bremGammaTracks_; }
+            static std::vector<G4Track*> getBremGammaList() { return bremGammaTracks(); }
 
             /** 
              * Enable/disable killing of the recoil electron track.  If the 
@@ -138,7 +138,14 @@ namespace ldmx {
             /** Messenger used to pass arguments to this class. */
             TargetBremFilterMessenger* messenger_{nullptr};
 
-            static std::vector<G4Track*> bremGammaTracks_; 
+            /** 
+             * @return The brem gammas of the current event in this thread, 
+             *         allocated on first use by the thread.
+             */
+            static std::vector<G4Track*>& bremGammaTracks();
+
+            /** The brem gammas of the current event in this thread. */
+            static G4ThreadLocal std::vector<G4Track*>* bremGammaTracks_; 
 
             /** The volume that the filter will be applied to. */
             G4String volumeName_{"target_PV"};
@@ -11,7 +11,7 @@ namespace ldmx {
 
     bool BiasingMessenger::biasingEnabled_{false}; 
 
-    double BiasingMessenger::eventWeight_{1}; 
+    G4ThreadLocal double BiasingMessenger::eventWeight_{1}; 
 
     std::string BiasingMessenger::particleType_{"gamma"};
 
@@ -31,6 +31,13 @@ namespace ldmx {
         particleTypeCmd_->SetParameterName("type", true); 
         particleTypeCmd_->AvailableForStates(G4ApplicationState::G4State_PreInit); 
         particleTypeCmd_->SetGuidance("The particle type to bias.");
+
+        // This messenger only exists on the master thread.
+        enableBiasingCmd_->SetToBeBroadcasted(false);
+        particleTypeCmd_->SetToBeBroadcasted(false);
+        processCmd_->SetToBeBroadcasted(false);
+        thresholdCmd_->SetToBeBroadcasted(false);
+        volumeCmd_->SetToBeBroadcasted(false);
     }
 
     BiasingMessenger::~BiasingMessenger() {
@@ -8,6 +8,11 @@
 
 #include "Biasing/EcalProcessFilter.h"
 
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "SimCore/ProcessCache.h"
+
 SIM_PLUGIN(ldmx, EcalProcessFilter)
 
 namespace ldmx { 
@@ -183,7 +188,8 @@ namespace ldmx {
 
             // If the brem gamma interacts and produces secondaries, get the 
             // process used to create them. 
-            G4String processName = secondaries->at(0)->GetCreatorProcess()->GetProcessName(); 
+            const std::string& processName = 
+                ProcessCache::getInstance()->getFullName(secondaries->at(0)->GetCreatorProcess()); 
             
             /*std::cout << "[ EcalProcessFilter ]: "
                         << "Brem photon produced " << secondaries->size() 
@@ -191,7 +197,7 @@ namespace ldmx {
                         << std::endl;*/
 
             // Only record the process that is being biased
-            if (!processName.contains(BiasingMessenger::getProcess())) {
+            if (processName.find(BiasingMessenger::getProcess()) == std::string::npos) {
 
                 /*std::cout << "[ EcalProcessFilter ]: "
                             << "Process was not " << BiasingMessenger::getProcess() 
@@ -7,6 +7,11 @@
 
 #include "Biasing/SimpleProcessFilter.h"
 
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "SimCore/ProcessCache.h"
+
 SIM_PLUGIN(ldmx, SimpleProcessFilter)
 
 namespace ldmx { 
@@ -86,16 +91,13 @@ namespace ldmx {
         
         } else { 
        
-            G4String processName = secondaries->at(0)->GetCreatorProcess()->GetProcessName(); 
+            const std::string& processName = 
+                ProcessCache::getInstance()->getName(secondaries->at(0)->GetCreatorProcess()); 
             
             /*std::cout << "[ SimpleProcessFilter ]: "
                       << particleName << " produced " << secondaries->size() 
                       << " secondaries via " << processName << " process." 
                       << std::endl;*/
-            if (processName.find("biasWrapper") != std::string::npos) { 
-                std::size_t pos = processName.find_first_of("(") + 1;
-                processName = processName.substr(pos, processName.size() - pos - 1); 
-            }  
 
             // Only record the process that is being biased
             if (!processName.empty() && (processName.compare(processName_) != 0)) {
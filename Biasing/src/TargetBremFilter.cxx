@@ -8,11 +8,16 @@
 
 #include "Biasing/TargetBremFilter.h"
 
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "SimCore/ProcessCache.h"
+
 SIM_PLUGIN(ldmx, TargetBremFilter)
 
 namespace ldmx { 
 
-    std::vector<G4Track*> TargetBremFilter::bremGammaTracks_ = {};
+    G4ThreadLocal std::vector<G4Track*>* TargetBremFilter::bremGammaTracks_ = nullptr;
 
     TargetBremFilter::TargetBremFilter() {
         messenger_ = new TargetBremFilterMessenger(this);
@@ -95,7 +100,7 @@ namespace ldmx {
         if (step->GetPostStepPoint()->GetStepStatus() == fGeomBoundary) { 
            
             // Clear all of the gamma tracks remaining from the previous event.
-            TargetBremFilter::bremGammaTracks_.clear();
+            bremGammaTracks().clear();
 
             /*std::cout << "[ TargetBremFilter ]: "
                         << "Particle " << particleName << "is leaving the "
@@ -135,15 +140,16 @@ namespace ldmx {
        
             bool hasBremCandidate = false; 
             for (auto& secondary_track : *secondaries) {
-                G4String processName = secondary_track->GetCreatorProcess()->GetProcessName();
+                const std::string& processName = 
+                    ProcessCache::getInstance()->getFullName(secondary_track->GetCreatorProcess());
                 /*std::cout << "[ TargetBremFilter ]: "
                             << "Secondary produced via process " << processName 
                             << std::endl;*/
-                if (processName.compareTo("eBrem") == 0 
+                if (processName == "eBrem" 
                         && secondary_track->GetKineticEnergy() > bremEnergyThreshold_) {
                     /*std::cout << "[ TargetBremFilter ]: " 
                                 << "Adding secondary to brem list." << std::endl;*/
-                    TargetBremFilter::bremGammaTracks_.push_back(secondary_track); 
+                    bremGammaTracks().push_back(secondary_track); 
                     hasBremCandidate = true;
                 } 
             }
@@ -179,12 +185,17 @@ namespace ldmx {
     }
 
     void TargetBremFilter::endEvent(const G4Event*) {
-        bremGammaTracks_.clear();
+        bremGammaTracks().clear();
     }
     
     void TargetBremFilter::removeBremFromList(G4Track* track) {   
-        bremGammaTracks_.erase(std::remove(bremGammaTracks_.begin(), 
-                    bremGammaTracks_.end(), track), bremGammaTracks_.end());
+        std::vector<G4Track*>& tracks = bremGammaTracks();
+        tracks.erase(std::remove(tracks.begin(), tracks.end(), track), tracks.end());
+    }
+
+    std::vector<G4Track*>& TargetBremFilter::bremGammaTracks() {
+        if (!bremGammaTracks_) bremGammaTracks_ = new std::vector<G4Track*>;
+        return *bremGammaTracks_;
     }
 }
 
@@ -7,6 +7,11 @@
 
 #include "Biasing/TargetENProcessFilter.h"
 
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "SimCore/ProcessCache.h"
+
 SIM_PLUGIN(ldmx, TargetENProcessFilter)
 
 namespace ldmx { 
@@ -68,7 +73,8 @@ namespace ldmx {
             return;
         } else { 
        
-            G4String processName = secondaries->at(0)->GetCreatorProcess()->GetProcessName(); 
+            const std::string& processName = 
+                ProcessCache::getInstance()->getFullName(secondaries->at(0)->GetCreatorProcess()); 
             
             /*std::cout << "[ TargetENProcessFilter ]: "
                       << "Electron produced " << secondaries->size() 
@@ -76,7 +82,7 @@ namespace ldmx {
                       << std::endl;*/
 
             // Only record the process that is being biased
-            if (!processName.contains(BiasingMessenger::getProcess())) {
+            if (processName.find(BiasingMessenger::getProcess()) == std::string::npos) {
 
                 /*std::cout << "[ TargetENProcessFilter ]: "
                           << "Process was not " << BiasingMessenger::getProcess() << "--> Killing all tracks!" 
@@ -8,6 +8,11 @@
 
 #include "Biasing/TargetProcessFilter.h"
 
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "SimCore/ProcessCache.h"
+
 SIM_PLUGIN(ldmx, TargetProcessFilter)
 
 namespace ldmx { 
@@ -126,7 +131,8 @@ namespace ldmx {
             }
         } else { 
        
-            G4String processName = secondaries->at(0)->GetCreatorProcess()->GetProcessName(); 
+            const std::string& processName = 
+                ProcessCache::getInstance()->getFullName(secondaries->at(0)->GetCreatorProcess()); 
             
             /*std::cout << "[ TargetProcessFilter ]: "
                       << "Brem photon produced " << secondaries->size() 
@@ -134,7 +140,7 @@ namespace ldmx {
                       << std::endl;*/
 
             // Only record the process that is being biased
-            if (!processName.contains(BiasingMessenger::getProcess())) {
+            if (processName.find(BiasingMessenger::getProcess()) == std::string::npos) {
 
                 /*std::cout << "[ TargetProcessFilter ]: "
                           << "Process was not " << BiasingMessenger::getProcess() << "--> Killing all tracks!" 
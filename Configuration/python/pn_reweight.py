@@ -24,6 +24,20 @@ pn_reweight = ldmxcfg.Producer("pn_reweight", "ldmx::PnWeightProcessor")
 pn_reweight.parameters["w_threshold"] = 1150.
 pn_reweight.parameters["w_theta"] = 100.
 
+# Parameters of the fits to the lower slope, exp(a1 - a0*W), and to the high
+# tail, exp(b1 - b0*W)*(b2 + b3*W + ... + b8*W^6), of the inclusive W 
+# distribution.  The weight is the ratio of the two.
+pn_reweight.parameters["low_fit_parameters"] = [0.01093, 2.766]
+pn_reweight.parameters["high_fit_parameters"] = [0.004008, 11.23, 1.242e-6, -1.964e-9, 
+        8.243e-13, 9.333e-17, -7.584e-20, -1.991e-23, 9.757e-27]
+
+# Range of W (MeV) over which the weight is interpolated from a table, and the
+# largest relative deviation of the table from the fits.  Outside of the range
+# the fits are evaluated directly.
+pn_reweight.parameters["table_w_min"] = 1150.
+pn_reweight.parameters["table_w_max"] = 3700.
+pn_reweight.parameters["table_tolerance"] = 1e-5
+
 # Define the sequence of event processors to be run
 p.sequence = [pn_reweight]
 
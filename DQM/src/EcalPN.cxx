@@ -166,15 +166,11 @@ namespace ldmx {
 
     void EcalPN::analyze(const Event & event) { 
   
-        // Get the collection of simulated particles from the event
-        const TClonesArray* particles = event.getCollection("SimParticles");
-      
-        // Search for the recoil electron 
-        const SimParticle* recoil = Analysis::searchForRecoil(particles); 
-
-        // Use the recoil electron to retrieve the gamma that underwent a 
-        // photo-nuclear reaction.
-        const SimParticle* pnGamma = Analysis::searchForPNGamma(recoil);
+        // Get the recoil electron and use it to retrieve the gamma that 
+        // underwent a photo-nuclear reaction. Both are cached on the event 
+        // so other processors can reuse the search results.
+        const SimParticle* recoil = event.getDerived<Analysis::RecoilElectron>(); 
+        const SimParticle* pnGamma = event.getDerived<Analysis::PNGamma>();
         if (pnGamma == nullptr) { 
             std::cout << "[ EcalPN ]: PN Daughter is lost, skipping." << std::endl;
             return;
@@ -57,21 +57,16 @@ namespace ldmx {
         // the event.
         if (!event.exists("FindableTracks")) return;
 
-        // Get the collection of simulated particles from the event
-        const TClonesArray* tracks 
-            = event.getCollection("FindableTracks");
-
-        TrackMaps map = Analysis::getFindableTrackMaps(tracks);
+        // Get the findable track maps built from the collection of findable
+        // tracks in the event
+        const TrackMaps& map = event.getDerived<Analysis::FindableTrackMaps>();
       
         histograms_->get("track_count")->Fill(map.findable.size());  
         histograms_->get("loose_track_count")->Fill(map.loose.size());  
         histograms_->get("axial_track_count")->Fill(map.axial.size());  
 
-        // Get the collection of simulated particles from the event
-        const TClonesArray* particles = event.getCollection("SimParticles");
-      
         // Search for the recoil electron 
-        const SimParticle* recoil = Analysis::searchForRecoil(particles);
+        const SimParticle* recoil = event.getDerived<Analysis::RecoilElectron>();
 
 
         bool recoilIsFindable{false}; 
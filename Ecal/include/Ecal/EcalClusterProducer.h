@@ -58,6 +58,10 @@ namespace ldmx {
         private:
 
             TClonesArray* ecalClusters_{nullptr};
+
+            /** The cluster finder, reused across events. */
+            TemplatedClusterFinder<MyClusterWeight> finder_;
+
             EcalHexReadout* hexReadout_{nullptr};
             double seedThreshold_{0};
             double cutoff_{0};
@@ -8,19 +8,45 @@
 #include "Ecal/WorkingCluster.h"
 #include "TH2F.h"
 
+#include <algorithm>
 #include <math.h>
-#include <map>
+#include <utility>
+#include <vector>
 
 namespace ldmx {
 
+    /**
+     * The finder is meant to be kept across events: clear() resets it while
+     * keeping the capacity of its buffers, and the hits of all clusters live
+     * in a single arena.
+     */
     template <class WeightClass>
 
     class TemplatedClusterFinder {
     
         public:
 
+            /** Reset the finder for a new event, keeping the allocated buffers. */
+            void clear() {
+                hits_.clear();
+                nextHit_.clear();
+                clusters_.clear();
+                transitionWeights_.clear();
+            }
+
+            /** Reserve the buffers for the given number of hits. */
+            void reserve(std::size_t nHits) {
+                hits_.reserve(nHits);
+                nextHit_.reserve(nHits);
+                clusters_.reserve(nHits);
+                transitionWeights_.reserve(nHits + 1);
+            }
+
             void add(const EcalHit* eh, const EcalHexReadout* hex, double zPos) {
-                clusters_.push_back(WorkingCluster(eh, hex, zPos));
+                int index = hits_.size();
+                hits_.push_back(eh);
+                nextHit_.push_back(-1);
+                clusters_.push_back(WorkingCluster(eh, hex, zPos, index));
             }
 
             static bool compClusters(const WorkingCluster& a, const WorkingCluster& b) {
@@ -65,13 +91,13 @@ namespace ldmx {
                     }
 
                     nseeds_ = nseeds;
-                    transitionWeights_.insert(std::pair<int, double>(ncluster, minwgt));
+                    transitionWeights_.emplace_back(ncluster, minwgt);
     
                     if (any && minwgt < cutoff) {
                         // put the bigger one in mi
                         if (clusters_[mi].centroid().E() < clusters_[mj].centroid().E()) { std::swap(mi,mj); }
                         // now we have the smallest, merge
-                        clusters_[mi].add(clusters_[mj]);
+                        clusters_[mi].add(clusters_[mj], nextHit_);
                         clusters_[mj].clear();
                         // decrement cluster count
                         ncluster--;
@@ -85,19 +111,37 @@ namespace ldmx {
 
             int getNSeeds() const { return nseeds_; }
 
-            std::map<int, double> getWeights() const { return transitionWeights_; }
+            /**
+             * The smallest weight found at each step of the clustering, paired
+             * with the number of clusters before the step.  The number of
+             * clusters decreases along the list.
+             */
+            const std::vector<std::pair<int, double> >& getWeights() const { return transitionWeights_; }
 
-            std::vector<WorkingCluster> getClusters() const {
+            /** The clusters, including the empty ones that were merged into others. */
+            const std::vector<WorkingCluster>& getClusters() const {
                 return clusters_;
             }
+
+            /** Get a hit from its arena index. */
+            const EcalHit* getHit(int index) const { return hits_[index]; }
+
+            /** Get the arena index of the next hit in the same cluster, or -1 after the last one. */
+            int getNextHit(int index) const { return nextHit_[index]; }
     
         private:
     
             WeightClass wgt_;
             double finalwgt_;
             int nseeds_;
-            std::map<int, double> transitionWeights_;
+            std::vector<std::pair<int, double> > transitionWeights_;
             std::vector<WorkingCluster> clusters_;
+
+            /** The hits being clustered. */
+            std::vector<const EcalHit*> hits_;
+
+            /** The links between the hits of each cluster, indexed like the hits. */
+            std::vector<int> nextHit_;
     };
 }
 
@@ -12,34 +12,53 @@
 
 namespace ldmx {
 
+    /**
+     * The hits of a working cluster are not owned by it.  They are kept as
+     * a linked list of indices into the hit arena of the cluster finder, so
+     * merging two clusters splices their lists without copying.
+     */
     class WorkingCluster {
 
         public:
 
-            WorkingCluster(const EcalHit* eh, const EcalHexReadout* hex, double zPos);
+            /**
+             * Start a cluster from a single hit.
+             * @param index The index of the hit in the hit arena.
+             */
+            WorkingCluster(const EcalHit* eh, const EcalHexReadout* hex, double zPos, int index);
 
             ~WorkingCluster() {};
 
-            void add(const EcalHit* eh, const EcalHexReadout* hex, double zPos);
-    
-            void add(const WorkingCluster& wc);
+            /**
+             * Merge another cluster into this one.
+             * @param wc The cluster to merge, which should be cleared afterwards.
+             * @param nextHit The links of the hit arena, indexed by hit index.
+             */
+            void add(const WorkingCluster& wc, std::vector<int>& nextHit);
 
-            const TLorentzVector& centroid() const { 
-                return centroid_; 
-            } 
-
-            std::vector<const EcalHit*> getHits() const {
-                return hits_;
+            const TLorentzVector& centroid() const {
+                return centroid_;
             }
 
-            bool empty() const { return hits_.empty(); }
+            /** @return The arena index of the first hit, or -1 if the cluster is empty. */
+            int getFirstHit() const { return firstHit_; }
 
-            void clear() { hits_.clear(); }
+            /** @return The number of hits in the cluster. */
+            int getNHits() const { return nHits_; }
 
-        private:
+            bool empty() const { return nHits_ == 0; }
 
+            void clear() {
+                firstHit_ = -1;
+                lastHit_ = -1;
+                nHits_ = 0;
+            }
+
+        private:
 
-            std::vector<const EcalHit*> hits_;
+            int firstHit_{-1};
+            int lastHit_{-1};
+            int nHits_{0};
             TLorentzVector centroid_;
     };
 }
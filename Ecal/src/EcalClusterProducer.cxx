@@ -30,13 +30,14 @@ namespace ldmx {
 
         static const double layerZPos[] = {-137.2, -134.3, -127.95, -123.55, -115.7, -109.8, -100.7, -94.3, -85.2, -78.8, -69.7, -63.3, -54.2, -47.8, -38.7, -32.3, -23.2, -16.8, -7.7, -1.3, 7.8, 14.2, 23.3, 29.7, 42.3, 52.2, 64.8, 74.7, 87.3, 97.2, 109.8, 119.7, 132.3, 142.2};
 
-        TemplatedClusterFinder<MyClusterWeight> cf;
-
         TClonesArray* ecalDigiHits = (TClonesArray*) event.getCollection("ecalDigis", digisPassName_);
         int nEcalDigis = ecalDigiHits->GetEntries();
 
         // Don't do anything if there are no ECal digis!
         if (!(nEcalDigis > 0)) { return; }
+
+        finder_.clear();
+        finder_.reserve(nEcalDigis);
         
         for (int iDigi = 0; iDigi < nEcalDigis; iDigi++) {
 
@@ -45,33 +46,39 @@ namespace ldmx {
             //Skip zero energy digis.
             if (aDigi->getEnergy() == 0) { continue; }
 
-            cf.add(aDigi, hexReadout_, layerZPos[aDigi->getLayer()]);
+            finder_.add(aDigi, hexReadout_, layerZPos[aDigi->getLayer()]);
         }
 
-        cf.cluster(seedThreshold_, cutoff_);
-        std::vector<WorkingCluster> wcVec = cf.getClusters();
+        finder_.cluster(seedThreshold_, cutoff_);
+        const std::vector<WorkingCluster>& wcVec = finder_.getClusters();
     
-        std::map<int, double> cWeights = cf.getWeights();
+        // The first weight is from the step with the most clusters.
+        const std::vector<std::pair<int, double> >& cWeights = finder_.getWeights();
     
-        algoResult_.set(algoName_, 3, cWeights.rbegin()->first);
+        algoResult_.set(algoName_, 3, cWeights.front().first);
         algoResult_.setAlgoVar(0, cutoff_);
         algoResult_.setAlgoVar(1, seedThreshold_);
-        algoResult_.setAlgoVar(2, cf.getNSeeds());
+        algoResult_.setAlgoVar(2, finder_.getNSeeds());
     
-        std::map<int, double>::iterator it = cWeights.begin();
-        for (it = cWeights.begin(); it != cWeights.end(); it++) {
-            algoResult_.setWeight(it->first, it->second/100);
+        for (const std::pair<int, double>& weight : cWeights) {
+            algoResult_.setWeight(weight.first, weight.second/100);
         }
 
+        ecalClusters_->Clear("C");
         int iC = 0;
-        for (int aWC = 0; aWC < wcVec.size(); aWC++) {
+        for (const WorkingCluster& wc : wcVec) {
     
+            // Skip the clusters that were merged into others.
+            if (wc.empty()) continue;
+
             EcalCluster* cluster = (EcalCluster*) (ecalClusters_->ConstructedAt(iC));
     
-            cluster->setEnergy(wcVec[aWC].centroid().E());
-            cluster->setCentroidXYZ(wcVec[aWC].centroid().Px(), wcVec[aWC].centroid().Py(), wcVec[aWC].centroid().Pz());
-            cluster->setNHits(wcVec[aWC].getHits().size());
-            cluster->addHits(wcVec[aWC].getHits());
+            cluster->setEnergy(wc.centroid().E());
+            cluster->setCentroidXYZ(wc.centroid().Px(), wc.centroid().Py(), wc.centroid().Pz());
+            cluster->setNHits(wc.getNHits());
+            for (int iHit = wc.getFirstHit(); iHit >= 0; iHit = finder_.getNextHit(iHit)) {
+                cluster->addHitID(finder_.getHit(iHit)->getID());
+            }
     
             iC++;
         }
@@ -7,12 +7,9 @@
 
 namespace ldmx {
 
-    WorkingCluster::WorkingCluster(const EcalHit* eh, const EcalHexReadout* hex, double zPos) {
-        add(eh, hex, zPos);
-    }
+    WorkingCluster::WorkingCluster(const EcalHit* eh, const EcalHexReadout* hex, double zPos, int index) :
+            firstHit_(index), lastHit_(index), nHits_(1) {
 
-    void WorkingCluster::add(const EcalHit* eh, const EcalHexReadout* hex, double zPos) {
-    
         double hitE = eh->getEnergy();
         unsigned int hitID = eh->getID();
 
@@ -21,36 +18,33 @@ namespace ldmx {
         unsigned int combinedID = 10*cellID + moduleID;
 
         std::pair<double, double> hitXY = hex->getCellCenterAbsolute(combinedID);
-    
-        double newE = hitE + centroid_.E();
-        double newCentroidX = (centroid_.Px()*centroid_.E() + hitE*hitXY.first) / newE;
-        double newCentroidY = (centroid_.Py()*centroid_.E() + hitE*hitXY.second) / newE;
-        double newCentroidZ = (centroid_.Pz()*centroid_.E() + hitE*zPos) / newE;
-
-        centroid_.SetPxPyPzE(newCentroidX, newCentroidY, newCentroidZ, newE);
 
-        hits_.push_back(eh); 
+        centroid_.SetPxPyPzE(hitXY.first, hitXY.second, zPos, hitE);
     }
-    
-    void WorkingCluster::add(const WorkingCluster& wc) {
-    
+
+    void WorkingCluster::add(const WorkingCluster& wc, std::vector<int>& nextHit) {
+
         double clusterE = wc.centroid().E();
         double centroidX = wc.centroid().Px();
         double centroidY = wc.centroid().Py();
         double centroidZ = wc.centroid().Pz();
-    
+
         double newE = clusterE + centroid_.E();
         double newCentroidX = (centroid_.Px()*centroid_.E() + clusterE*centroidX) / newE;
         double newCentroidY = (centroid_.Py()*centroid_.E() + clusterE*centroidY) / newE;
         double newCentroidZ = (centroid_.Pz()*centroid_.E() + clusterE*centroidZ) / newE;
-    
+
         centroid_.SetPxPyPzE(newCentroidX, newCentroidY, newCentroidZ, newE);
 
-        std::vector<const EcalHit*> clusterHits = wc.getHits();
-    
-        for (size_t i = 0; i < clusterHits.size(); i++) {
-    
-            hits_.push_back(clusterHits[i]);
+        if (wc.empty()) return;
+
+        // Splice the hits of the other cluster after ours
+        if (empty()) {
+            firstHit_ = wc.firstHit_;
+        } else {
+            nextHit[lastHit_] = wc.firstHit_;
         }
+        lastHit_ = wc.lastHit_;
+        nHits_ += wc.nHits_;
     }
 }
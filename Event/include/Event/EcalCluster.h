@@ -63,6 +63,14 @@ namespace ldmx {
              */
             void addHits(const std::vector<const EcalHit*> hitsVec);
 
+            /**
+             * Add the ID of one of the hits that make up the cluster.
+             * @param hitID The ID of the hit.
+             */
+            void addHitID(unsigned int hitID) {
+                hitIDs_.push_back(hitID);
+            }
+
             /**
              * Sets total energy for the cluster.
              * @param energy The total energy of the cluster.
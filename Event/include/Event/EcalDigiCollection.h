@@ -0,0 +1,156 @@
+/**
+ * @file EcalDigiCollection.h
+ * @brief Class that stores the ECal digis of an event in a compact encoding
+ */
+
+#ifndef EVENT_ECALDIGICOLLECTION_H_
+#define EVENT_ECALDIGICOLLECTION_H_
+
+//----------//
+//   LDMX   //
+//----------//
+#include "Event/EcalHit.h"
+
+//----------//
+//   ROOT   //
+//----------//
+#include "TClonesArray.h"
+#include "TObject.h"
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <cstdint>
+#include <vector>
+
+namespace ldmx {
+
+    /**
+     * @class EcalDigiCollection
+     * @brief Stores the ECal digis of an event in a compact encoding
+     *
+     * @note The hits are sorted by ID and written to one byte stream.  Each
+     * hit is the difference of its ID to the ID of the previous hit, with the
+     * noise flag in the lowest bit, followed by its amplitude, energy and time
+     * in fixed-point, all as variable length integers.  The position of a hit
+     * is not stored since it follows from the ID through EcalHexReadout.
+     *
+     * The hits are decoded on the first call to getHits() and handed out as
+     * EcalHit objects so readers keep using the existing hit interface.
+     */
+    class EcalDigiCollection : public TObject {
+
+        public:
+
+            /** Constructor. */
+            EcalDigiCollection() {}
+
+            /** Destructor. */
+            virtual ~EcalDigiCollection() {}
+
+            /** Clear the data in the object. */
+            void Clear(Option_t *option = "");
+
+            /**
+             * Copy this object.
+             * @param object The target object.
+             */
+            void Copy(TObject& object) const;
+
+            /** Print a text representation of this object. */
+            void Print(Option_t *option = "") const;
+
+            /**
+             * Set the precision of the amplitude and energy [MeV].
+             * @param precision The value of one fixed-point count.
+             */
+            void setEnergyPrecision(float precision) {
+                energyPrecision_ = precision;
+                decoded_ = false;
+            }
+
+            /** @return The precision of the amplitude and energy [MeV]. */
+            float getEnergyPrecision() const { return energyPrecision_; }
+
+            /**
+             * Set the precision of the time [ns].
+             * @param precision The value of one fixed-point count.
+             */
+            void setTimePrecision(float precision) {
+                timePrecision_ = precision;
+                decoded_ = false;
+            }
+
+            /** @return The precision of the time [ns]. */
+            float getTimePrecision() const { return timePrecision_; }
+
+            /**
+             * Encode a collection of hits, replacing the current content.
+             * @param hits The EcalHit objects to encode.
+             */
+            void pack(const TClonesArray* hits);
+
+            /** @return The number of hits. */
+            int getNumberOfHits() const { return nHits_; }
+
+            /** @return The size of the encoded hits in bytes. */
+            int getEncodedSize() const { return data_.size(); }
+
+            /**
+             * Get the decoded hits, sorted by ID.
+             * @return The hits.
+             */
+            const std::vector<EcalHit>& getHits() const;
+
+            /**
+             * Decode the hits into a collection of EcalHit objects.
+             * @param hits The collection to fill, which is cleared first.
+             */
+            void unpack(TClonesArray* hits) const;
+
+        private:
+
+            /** Append an unsigned variable length integer to the stream. */
+            void putVarint(uint64_t value);
+
+            /** Read an unsigned variable length integer from the stream. */
+            uint64_t getVarint(std::size_t& position) const;
+
+            /** Convert a value to a signed fixed-point count. */
+            static int32_t toFixed(float value, float precision);
+
+            /** Map a signed count to an unsigned one with small magnitudes staying small. */
+            static uint32_t zigzag(int32_t value) { return (uint32_t(value) << 1) ^ uint32_t(value >> 31); }
+
+            /** Inverse of zigzag(). */
+            static int32_t unzigzag(uint32_t value) { return int32_t(value >> 1) ^ -int32_t(value & 1); }
+
+        private:
+
+            /** The value of one amplitude or energy count [MeV]. */
+            float energyPrecision_{0.001};
+
+            /** The value of one time count [ns]. */
+            float timePrecision_{0.01};
+
+            /** The number of hits. */
+            int nHits_{0};
+
+            /** The encoded hits. */
+            std::vector<unsigned char> data_;
+
+            /** The decoded hits. */
+            mutable std::vector<EcalHit> hits_; //!
+
+            /**
+             * Flag indicating if the hits have been decoded, reset whenever the
+             * encoded hits change, including when ROOT reads a new entry.
+             */
+            mutable bool decoded_{false}; //!
+
+            /** The ROOT class definition. */
+            ClassDef(EcalDigiCollection, 1);
+    };
+}
+
+#endif /* EVENT_ECALDIGICOLLECTION_H_ */
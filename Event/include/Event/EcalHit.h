@@ -49,7 +49,7 @@ namespace ldmx {
             void setNoiseHit(bool isNoise = true) { isNoise_ = isNoise; }
 
             /** Check whether this hit is due to noise. */
-            bool isNoise() { return isNoise_; }
+            bool isNoise() const { return isNoise_; }
 
         private:
 
@@ -13,13 +13,51 @@
 
 // LDMX
 #include "Event/EventHeader.h"
+#include "Event/HitColumns.h"
 
 // STL
 #include <string>
 #include <map>
+#include <typeindex>
+#include <typeinfo>
 
 namespace ldmx {
 
+    /**
+     * @class DerivedObjectBase
+     * @brief Type-erased holder for an object derived from event data
+     */
+    class DerivedObjectBase {
+
+        public:
+
+            /**
+             * Class destructor.
+             */
+            virtual ~DerivedObjectBase() {
+            }
+    };
+
+    /**
+     * @class DerivedObject
+     * @brief Holds a derived object of a specific type
+     */
+    template<typename ValueType> class DerivedObject : public DerivedObjectBase {
+
+        public:
+
+            /**
+             * Class constructor.
+             * @param value The derived object to hold.
+             */
+            DerivedObject(const ValueType& value) :
+                value_(value) {
+            }
+
+            /** The derived object. */
+            ValueType value_;
+    };
+
     /**
      * @class Event
      * @brief Defines an interface for accessing event data
@@ -119,6 +157,27 @@ namespace ldmx {
                 return (TClonesArray*) getReal(collectionName, passName, true);
             }
 
+            /**
+             * Get a hit collection as columns without specifying the pass name.
+             * HitColumns products are returned as they are, while TClonesArray
+             * hit collections are converted once per event.
+             * @param collectionName Name given to the collection when it was put into the event.
+             * @return The hits of the named collection as columns.
+             */
+            const HitColumns& getHitColumns(const std::string& collectionName) const {
+                return *getHitColumnsReal(collectionName, "");
+            }
+
+            /**
+             * Get a hit collection as columns, specifying the pass name.
+             * @param collectionName Name given to the collection when it was put into the event.
+             * @param passName The process pass label which was in use when this object was put into the event, such as "sim" or "rerecov2".
+             * @return The hits of the named collection as columns.
+             */
+            const HitColumns& getHitColumns(const std::string& collectionName, const std::string& passName) const {
+                return *getHitColumnsReal(collectionName, passName);
+            }
+
             /**
              * Add a collection (TClonesArray) of objects to the event.
              * The current pass name will be used for the collection.
@@ -145,6 +204,27 @@ namespace ldmx {
              */
             virtual void addToCollection(const std::string& name, const TObject& obj) = 0;
 
+            /**
+             * Get an object derived from the event data (e.g. the recoil electron),
+             * computing it on the first request in the current event.  The result
+             * is cached until the next event is loaded, so processors which need
+             * the same derived object share a single computation.
+             *
+             * The tag type must define the type of the derived object as
+             * 'value_type' and provide a static method 'compute(const Event&)'
+             * that builds it.  The computation should only depend on objects
+             * which are not modified later in the event.
+             * @return The derived object for the current event.
+             */
+            template<typename Tag> const typename Tag::value_type& getDerived() const {
+                typedef DerivedObject<typename Tag::value_type> Holder;
+                const DerivedObjectBase* cached = getDerivedReal(typeid(Tag));
+                if (!cached) {
+                    cached = setDerivedReal(typeid(Tag), new Holder(Tag::compute(*this)));
+                }
+                return static_cast<const Holder*>(cached)->value_;
+            }
+
         protected:
 
             /**
@@ -156,6 +236,29 @@ namespace ldmx {
              */
             virtual const TObject* getReal(const std::string& itemName, const std::string& passName, bool mustExist) const = 0;
 
+            /**
+             * Get a hit collection as columns, provided by derived class.
+             * @param collectionName The name of the collection.
+             * @param passName The process pass label which was in use when the collection was put into the event.
+             * @return The hits of the collection as columns.
+             */
+            virtual const HitColumns* getHitColumnsReal(const std::string& collectionName, const std::string& passName) const = 0;
+
+            /**
+             * Get a cached derived object, provided by derived class.
+             * @param tag The type of the tag identifying the derived object.
+             * @return The cached derived object or null if it has not been computed in this event.
+             */
+            virtual const DerivedObjectBase* getDerivedReal(const std::type_index& tag) const = 0;
+
+            /**
+             * Cache a derived object for the rest of the event, provided by derived class.
+             * @param tag The type of the tag identifying the derived object.
+             * @param obj The derived object, which is owned by the event after this call.
+             * @return The cached derived object.
+             */
+            virtual const DerivedObjectBase* setDerivedReal(const std::type_index& tag, DerivedObjectBase* obj) const = 0;
+
     };
 }
 
@@ -6,6 +6,7 @@
 
 #include "Event/CalorimeterHit.h"
 #include "Event/EcalHit.h"
+#include "Event/EcalDigiCollection.h"
 #include "Event/EcalVetoResult.h"
 #include "Event/NonFidEcalVetoResult.h"
 #include "Event/EcalCluster.h"
@@ -21,6 +22,7 @@
 #include "Event/TrackerVetoResult.h"
 #include "Event/ClusterAlgoResult.h"
 #include "Event/HcalHit.h"
+#include "Event/HitColumns.h"
 #include "Event/HcalVetoResult.h"
 #include "Event/PnWeightResult.h"
 #include "Event/SiStripHit.h"
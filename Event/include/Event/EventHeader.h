@@ -156,6 +156,17 @@ namespace ldmx {
                 return intParameters_[name];
             }
 
+            /**
+             * Get an int parameter value without adding it to the header.
+             * @param name The name of the parameter.
+             * @param defaultValue The value returned if the parameter is not set.
+             * @return The parameter value.
+             */
+            int getIntParameter(const std::string& name, int defaultValue) const {
+                auto it = intParameters_.find(name);
+                return (it != intParameters_.end()) ? it->second : defaultValue;
+            }
+
             /**
              * Set an int parameter value.
              * @param name The name of the parameter.
@@ -20,6 +20,8 @@
 #pragma link C++ class ldmx::HcalHit+;
 #pragma link C++ class ldmx::HcalVetoResult+;
 #pragma link C++ class ldmx::EcalHit+;
+#pragma link C++ class ldmx::EcalDigiCollection+;
+#pragma link C++ class ldmx::HitColumns+;
 #pragma link C++ class ldmx::EcalVetoResult+;
 #pragma link C++ class ldmx::NonFidEcalVetoResult+;
 #pragma link C++ class ldmx::EcalCluster+;
@@ -37,5 +39,35 @@
 #pragma link C++ class ldmx::SiStripHit+; 
 #pragma link C++ class ldmx::RawHit+; 
 
+// Schema evolution from the TRef based SimParticle links.  The reference UIDs
+// are kept in transient members and converted to track IDs by the
+// SimParticleResolver once the SimParticles of the event are available.
+#pragma read sourceClass="ldmx::SimParticle" version="[-5]" targetClass="ldmx::SimParticle" \
+    source="TRefArray* daughters_; TRefArray* parents_" \
+    target="daughterUIDs_, parentUIDs_, daughterTrackIDs_, parentTrackIDs_" include="TRefArray.h" \
+    code="{ daughterUIDs_.clear(); parentUIDs_.clear(); daughterTrackIDs_.clear(); parentTrackIDs_.clear(); \
+            if (onfile.daughters_) for (int i = 0; i < onfile.daughters_->GetEntriesFast(); ++i) daughterUIDs_.push_back(onfile.daughters_->GetUID(i)); \
+            if (onfile.parents_) for (int i = 0; i < onfile.parents_->GetEntriesFast(); ++i) parentUIDs_.push_back(onfile.parents_->GetUID(i)); }"
+
+#pragma read sourceClass="ldmx::SimCalorimeterHit" version="[-2]" targetClass="ldmx::SimCalorimeterHit" \
+    source="TRefArray* simParticleContribs_" \
+    target="contribUIDs_, trackIDContribs_" include="TRefArray.h" \
+    code="{ contribUIDs_.clear(); trackIDContribs_.clear(); \
+            if (onfile.simParticleContribs_) for (int i = 0; i < onfile.simParticleContribs_->GetEntriesFast(); ++i) { \
+                contribUIDs_.push_back(onfile.simParticleContribs_->GetUID(i)); trackIDContribs_.push_back(-1); } }"
+
+#pragma read sourceClass="ldmx::SimTrackerHit" version="[-3]" targetClass="ldmx::SimTrackerHit" \
+    source="TRef simParticle_" target="simParticleUID_, simParticleTrackID_" include="TRef.h" \
+    code="{ simParticleUID_ = onfile.simParticle_.GetUniqueID(); simParticleTrackID_ = -1; }"
+
+#pragma read sourceClass="ldmx::FindableTrackResult" version="[-3]" targetClass="ldmx::FindableTrackResult" \
+    source="TRef simParticle_" target="simParticleUID_, simParticleTrackID_" include="TRef.h" \
+    code="{ simParticleUID_ = onfile.simParticle_.GetUniqueID(); simParticleTrackID_ = -1; }"
+
+// The decoded hits are a cache of the encoded ones, so they are decoded again
+// after ROOT reads new encoded hits into an existing collection.
+#pragma read sourceClass="ldmx::EcalDigiCollection" version="[1-]" targetClass="ldmx::EcalDigiCollection" \
+    source="" target="decoded_" code="{ decoded_ = false; }"
+
 #endif
 
@@ -23,7 +23,6 @@
 //   ROOT   //
 //----------//
 #include <TObject.h>
-#include <TRef.h>
 
 namespace ldmx { 
     
@@ -90,12 +89,25 @@ namespace ldmx {
             /**
              * Get the sim particle associated with this result.
              */
-            SimParticle* getSimParticle() const { return (SimParticle*) simParticle_.GetObject(); };
+            SimParticle* getSimParticle() const { return simParticle_; };
+
+            /**
+             * Get the track ID of the sim particle associated with this result.
+             */
+            int getSimParticleTrackID() const { return simParticleTrackID_; };
             
             /**
              * Set the sim particle associated with this result.
              */
-            void setSimParticle(SimParticle* simParticle) { simParticle_ = simParticle; };
+            void setSimParticle(SimParticle* simParticle) { 
+                simParticle_ = simParticle; 
+                simParticleTrackID_ = simParticle ? simParticle->getTrackID() : -1;
+            };
+
+            /**
+             * Fill the transient sim particle pointer from the persisted track ID.
+             */
+            void resolveLinks(const SimParticleResolver& resolver);
 
             /**
              * Set the sim particle and 'is findable' flag.
@@ -109,9 +121,17 @@ namespace ldmx {
             void Print(Option_t *option = "");
 
         private:
+
+            friend class SimParticleResolver;
             
-            /** Refence to the sim particle. */
-            TRef simParticle_{nullptr};
+            /** Track ID of the sim particle. */
+            int simParticleTrackID_{-1};
+
+            /** The resolved sim particle (not persisted). */
+            SimParticle* simParticle_{nullptr}; //!
+
+            /** Reference UID read from files written with a TRef link (not persisted). */
+            unsigned int simParticleUID_{0}; //!
 
             /**
              * Flag indicating whether a particle is findable using the
@@ -150,7 +170,7 @@ namespace ldmx {
              */
             bool is3sFindable_{false}; 
 
-        ClassDef(FindableTrackResult, 3); 
+        ClassDef(FindableTrackResult, 4); 
 
     }; // FindableTrackResult
 }
@@ -0,0 +1,225 @@
+/**
+ * @file HitColumns.h
+ * @brief Class that stores a collection of hits as one array per hit member
+ */
+
+#ifndef EVENT_HITCOLUMNS_H_
+#define EVENT_HITCOLUMNS_H_
+
+//----------//
+//   ROOT   //
+//----------//
+#include "TClonesArray.h"
+#include "TObject.h"
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <cstddef>
+#include <vector>
+
+namespace ldmx {
+
+    /**
+     * @class HitColumns
+     * @brief Stores a collection of hits as one array per hit member
+     *
+     * @note The IDs, energies, amplitudes, times and positions of the hits are
+     * kept in separate contiguous arrays, so loops over one member touch only
+     * that array and can be vectorized by the compiler.  When added to the
+     * event, each array is written to its own split branch.
+     *
+     * Columns can be filled from the existing hit collections with fill(),
+     * which is what Event::getHitColumns() uses for TClonesArray products.
+     * Single hits are accessed through the lightweight HitView, which also
+     * supports range-for iteration over the collection.
+     */
+    class HitColumns : public TObject {
+
+        public:
+
+            /**
+             * @class HitView
+             * @brief Read-only view of one hit of the columns
+             */
+            class HitView {
+
+                public:
+
+                    HitView(const HitColumns& columns, std::size_t index) :
+                            columns_(&columns), index_(index) {
+                    }
+
+                    /** @return The detector ID of the hit. */
+                    int getID() const { return columns_->id_[index_]; }
+
+                    /** @return The energy of the hit [MeV]. */
+                    float getEnergy() const { return columns_->energy_[index_]; }
+
+                    /** @return The amplitude of the hit. */
+                    float getAmplitude() const { return columns_->amplitude_[index_]; }
+
+                    /** @return The smallest amplitude of the readout channels of the hit. */
+                    float getMinAmplitude() const { return columns_->minAmplitude_[index_]; }
+
+                    /** @return The time of the hit [ns]. */
+                    float getTime() const { return columns_->time_[index_]; }
+
+                    /** @return The X position of the hit [mm]. */
+                    float getX() const { return columns_->x_[index_]; }
+
+                    /** @return The Y position of the hit [mm]. */
+                    float getY() const { return columns_->y_[index_]; }
+
+                    /** @return The Z position of the hit [mm]. */
+                    float getZ() const { return columns_->z_[index_]; }
+
+                    /** @return The layer of the hit from the ID. */
+                    int getLayer() const { return (getID() & 0xFF0) >> 4; }
+
+                    /** Move to the next hit, for iteration. */
+                    HitView& operator++() {
+                        ++index_;
+                        return *this;
+                    }
+
+                    /** @return This view, for iteration. */
+                    const HitView& operator*() const { return *this; }
+
+                    /** @return True if the views point to different hits. */
+                    bool operator!=(const HitView& other) const { return index_ != other.index_; }
+
+                private:
+
+                    /** The columns of the hit. */
+                    const HitColumns* columns_;
+
+                    /** The index of the hit. */
+                    std::size_t index_;
+            };
+
+            /** Constructor. */
+            HitColumns() {}
+
+            /** Destructor. */
+            virtual ~HitColumns() {}
+
+            /** Clear the data in the object. */
+            void Clear(Option_t *option = "");
+
+            /**
+             * Copy this object.
+             * @param object The target object.
+             */
+            void Copy(TObject& object) const;
+
+            /** Print a text representation of this object. */
+            void Print(Option_t *option = "") const;
+
+            /**
+             * Reserve space for a number of hits.
+             * @param nHits The number of hits.
+             */
+            void reserve(std::size_t nHits);
+
+            /**
+             * Append a hit read out by a single channel.
+             */
+            void addHit(int id, float energy, float amplitude, float time, float x = 0, float y = 0, float z = 0) {
+                addHit(id, energy, amplitude, time, x, y, z, amplitude);
+            }
+
+            /**
+             * Append a hit, giving the smallest amplitude of its readout
+             * channels, e.g. the minimum PE of a double ended HCal bar.
+             */
+            void addHit(int id, float energy, float amplitude, float time, float x, float y, float z, float minAmplitude) {
+                id_.push_back(id);
+                energy_.push_back(energy);
+                amplitude_.push_back(amplitude);
+                minAmplitude_.push_back(minAmplitude);
+                time_.push_back(time);
+                x_.push_back(x);
+                y_.push_back(y);
+                z_.push_back(z);
+            }
+
+            /**
+             * Replace the content with the hits of a collection.
+             * CalorimeterHit, SimCalorimeterHit and SimTrackerHit collections are
+             * supported.  The energy of simulated hits is their deposited energy,
+             * and reconstructed calorimeter hits other than HcalHit have no
+             * position.  The minimum amplitude of an HcalHit is its minimum PE.
+             * @param hits The collection.
+             * @return False if the class of the hits is not supported.
+             */
+            bool fill(const TClonesArray* hits);
+
+            /** @return The number of hits. */
+            std::size_t size() const { return id_.size(); }
+
+            /** @return The view of a hit. */
+            HitView operator[](std::size_t index) const { return HitView(*this, index); }
+
+            /** @return The view of the first hit, for iteration. */
+            HitView begin() const { return HitView(*this, 0); }
+
+            /** @return The view past the last hit, for iteration. */
+            HitView end() const { return HitView(*this, size()); }
+
+            /** @return The detector IDs. */
+            const std::vector<int>& getIDs() const { return id_; }
+
+            /** @return The energies [MeV]. */
+            const std::vector<float>& getEnergies() const { return energy_; }
+
+            /** @return The amplitudes. */
+            const std::vector<float>& getAmplitudes() const { return amplitude_; }
+
+            /** @return The smallest amplitudes of the readout channels. */
+            const std::vector<float>& getMinAmplitudes() const { return minAmplitude_; }
+
+            /** @return The times [ns]. */
+            const std::vector<float>& getTimes() const { return time_; }
+
+            /** @return The X positions [mm]. */
+            const std::vector<float>& getX() const { return x_; }
+
+            /** @return The Y positions [mm]. */
+            const std::vector<float>& getY() const { return y_; }
+
+            /** @return The Z positions [mm]. */
+            const std::vector<float>& getZ() const { return z_; }
+
+        private:
+
+            /** The detector IDs. */
+            std::vector<int> id_;
+
+            /** The energies. */
+            std::vector<float> energy_;
+
+            /** The amplitudes. */
+            std::vector<float> amplitude_;
+
+            /** The smallest amplitudes of the readout channels. */
+            std::vector<float> minAmplitude_;
+
+            /** The times. */
+            std::vector<float> time_;
+
+            /** The X positions. */
+            std::vector<float> x_;
+
+            /** The Y positions. */
+            std::vector<float> y_;
+
+            /** The Z positions. */
+            std::vector<float> z_;
+
+            /** The ROOT class definition. */
+            ClassDef(HitColumns, 2);
+    };
+}
+
+#endif /* EVENT_HITCOLUMNS_H_ */
@@ -9,11 +9,13 @@
 
 // ROOT
 #include "TObject.h"
-#include "TRefArray.h"
 
 // LDMX
 #include "Event/SimParticle.h"
 
+// STL
+#include <algorithm>
+
 namespace ldmx {
 
     /**
@@ -24,10 +26,11 @@ namespace ldmx {
      * This class represents simulated hit information from a calorimeter detector.
      * It provides access to the cell ID, energy deposition, cell position and time.
      * Additionally, individual depositions or steps from MC particles are tabulated
-     * as contributions stored in vectors.  Contribution information includes a reference
-     * to the relevant SimParticle, the PDG code of the actual particle which deposited
+     * as contributions stored in vectors.  Contribution information includes the track
+     * ID of the relevant SimParticle, the PDG code of the actual particle which deposited
      * energy (may be different from the actual SimParticle), the time of the contribution
-     * and the energy deposition.
+     * and the energy deposition.  The SimParticle pointers are transient and are filled
+     * in from the track IDs by a SimParticleResolver.
      */
     class SimCalorimeterHit: public TObject {
 
@@ -39,6 +42,7 @@ namespace ldmx {
              */
             struct Contrib {
                 SimParticle* particle{nullptr};
+                int trackID{-1};
                 int pdgCode{0};
                 float edep{0};
                 float time{0};
@@ -164,6 +168,16 @@ namespace ldmx {
              */
             int findContribIndex(SimParticle* simParticle, int pdgCode);
 
+            /**
+             * Check if a track contributed to the hit, comparing the stored
+             * track IDs without building the contributions.
+             * @param trackID The track ID of the SimParticle.
+             * @return True if the hit has a contribution from the track.
+             */
+            bool hasContribFromTrack(int trackID) const {
+                return std::find(trackIDContribs_.begin(), trackIDContribs_.end(), trackID) != trackIDContribs_.end();
+            }
+
             /**
              * Update an existing hit contribution by incrementing its edep and setting the time
              * if the new time is less than the old one.
@@ -173,8 +187,17 @@ namespace ldmx {
              */
             void updateContrib(int i, float edep, float time);
 
+            /**
+             * Fill the transient SimParticle pointers of the contributions 
+             * from the persisted track IDs.
+             * @param resolver The track ID lookup for the current event.
+             */
+            void resolveLinks(const SimParticleResolver& resolver);
+
         private:
 
+            friend class SimParticleResolver;
+
             /**
              * The detector ID.
              */
@@ -206,9 +229,21 @@ namespace ldmx {
             float time_{0};
 
             /**
-             * The list of SimParticle objects contributing to the hit.
+             * The track IDs of the SimParticle objects contributing to the hit.
+             * A value of -1 means the particle was not saved.
+             */
+            std::vector<int> trackIDContribs_;
+
+            /**
+             * The resolved SimParticle objects contributing to the hit (not persisted).
+             */
+            std::vector<SimParticle*> simParticleContribs_; //!
+
+            /**
+             * Contribution reference UIDs read from files written with 
+             * TRefArray links, converted to track IDs by the resolver (not persisted).
              */
-            TRefArray* simParticleContribs_;
+            std::vector<unsigned int> contribUIDs_; //!
 
             /**
              * The list of PDG codes contributing to the hit.
@@ -233,7 +268,7 @@ namespace ldmx {
             /**
              * ROOT class definition.
              */
-            ClassDef(SimCalorimeterHit, 2)
+            ClassDef(SimCalorimeterHit, 3)
     };
 
 }
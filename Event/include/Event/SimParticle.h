@@ -13,7 +13,6 @@
 //   ROOT   //
 //----------//
 #include "TObject.h"
-#include "TRefArray.h"
 
 //----------------//
 //   C++ StdLib   //
@@ -24,9 +23,16 @@
 
 namespace ldmx {
 
+    class SimParticleResolver;
+
     /**
      * @class SimParticle
      * @brief Represents MC particle information from a track in the simulation
+     *
+     * @note
+     * Parent and daughter links are persisted as Geant4 track IDs.  The
+     * pointers returned by getParent() and getDaughter() are transient and
+     * are filled in by a SimParticleResolver once per event.
      */
     class SimParticle: public TObject {
 
@@ -132,32 +138,34 @@ namespace ldmx {
             /** @return The charge of the particle. */
             double getCharge() const { return charge_; }
 
-            /** @return A reference to all daughter particles. */
-            TRefArray* getDaughters() const { return daughters_; }
+            /** @return The track IDs of the daughter particles. */
+            const std::vector<int>& getDaughterTrackIDs() const { return daughterTrackIDs_; }
 
             /** @return The number of daughter particles. */
-            int getDaughterCount() const { return daughters_->GetEntriesFast(); }
+            int getDaughterCount() const { return daughterTrackIDs_.size(); }
 
             /**
              * Retrieve a daughter particle by index. 
              * @param iDaughter The index of the daughter particle of interest.
+             * @return The daughter particle or nullptr if the link is not resolved.
              */
             SimParticle* getDaughter(const int& iDaughter) const { 
-                return static_cast<SimParticle*>(daughters_->At(iDaughter)); 
+                return iDaughter < daughters_.size() ? daughters_[iDaughter] : nullptr; 
             }
 
-            /** @return A reference to all of the parent particles. */
-            TRefArray* getParents() const { return parents_; }
+            /** @return The track IDs of the parent particles. */
+            const std::vector<int>& getParentTrackIDs() const { return parentTrackIDs_; }
             
             /** @return The number of parent particles. */
-            int getParentCount() const { return parents_->GetEntriesFast(); }
+            int getParentCount() const { return parentTrackIDs_.size(); }
 
             /**
              * Retrieve a parent particle by index.
              * @param iParent The index of the parent particle of interest.
+             * @return The parent particle or nullptr if the link is not resolved.
              */
             SimParticle* getParent(const int& iParent) const {
-                return static_cast<SimParticle*>(parents_->At(iParent));
+                return iParent < parents_.size() ? parents_[iParent] : nullptr;
             }
 
             /**
@@ -240,15 +248,30 @@ namespace ldmx {
 
             /**
              * Add a daughter particle.
+             * The track ID of the daughter must already be set.
              * @param daughter The daughter particle.
              */
-            void addDaughter(SimParticle* daughter) { daughters_->Add(daughter); }
+            void addDaughter(SimParticle* daughter) { 
+                daughterTrackIDs_.push_back(daughter->getTrackID()); 
+                daughters_.push_back(daughter);
+            }
 
             /**
              * Add a parent particle.
+             * The track ID of the parent must already be set.
              * @param parent The parent particle.
              */
-            void addParent(SimParticle* parent) { parents_->Add(parent); }
+            void addParent(SimParticle* parent) { 
+                parentTrackIDs_.push_back(parent->getTrackID()); 
+                parents_.push_back(parent);
+            }
+
+            /**
+             * Fill the transient parent and daughter pointers from the 
+             * persisted track IDs.
+             * @param resolver The track ID lookup for the current event.
+             */
+            void resolveLinks(const SimParticleResolver& resolver);
 
             /**
              * Get the creator process type of this particle.
@@ -283,6 +306,26 @@ namespace ldmx {
              */
             std::vector<double> getEndPointMomentum() const { return {endpx_, endpy_, endpz_}; }
 
+            /**
+             * Check if the particle contributed to an ECal sim hit.  This is
+             * only filled when the simulation wrote ECal hit contributions,
+             * which is marked by the ECAL_PARTICLE_FLAGS event header parameter.
+             * @return True if the particle has ECal hit contributions.
+             */
+            bool hasEcalHits() const { return TestBit(ECAL_HITS_BIT); }
+
+            /**
+             * Set whether the particle contributed to an ECal sim hit.
+             * @param hasEcalHits True if the particle has ECal hit contributions.
+             */
+            void setHasEcalHits(bool hasEcalHits) { SetBit(ECAL_HITS_BIT, hasEcalHits); }
+
+            /** 
+             * Name of the event header int parameter set when the ECal hit
+             * flags of the particles are filled.
+             */
+            static const std::string ECAL_PARTICLE_FLAGS;
+
             /**
              * Get the process type enum from a G4VProcess name.
              * @return The process type from the string.
@@ -291,8 +334,13 @@ namespace ldmx {
 
         private:
 
+            friend class SimParticleResolver;
+
             static ProcessTypeMap createProcessTypeMap();
 
+            /** User bit of TObject used for the ECal hit flag, persisted with the object. */
+            static const unsigned ECAL_HITS_BIT = BIT(14);
+
         private:
 
             /** The energy of the particle. */
@@ -352,11 +400,26 @@ namespace ldmx {
             /** The particle's charge. */
             double charge_{0};
 
-            /** The list of daughter particles. */
-            TRefArray* daughters_;
+            /** The track IDs of the daughter particles. */
+            std::vector<int> daughterTrackIDs_;
+
+            /** The track IDs of the parent particles. */
+            std::vector<int> parentTrackIDs_;
+
+            /** The resolved daughter particles (not persisted). */
+            std::vector<SimParticle*> daughters_; //!
+
+            /** The resolved parent particles (not persisted). */
+            std::vector<SimParticle*> parents_; //!
+
+            /** 
+             * Daughter reference UIDs read from files written with TRefArray
+             * links, converted to track IDs by the resolver (not persisted).
+             */
+            std::vector<unsigned int> daughterUIDs_; //!
 
-            /** The list of parent particles. */
-            TRefArray* parents_;
+            /** Parent reference UIDs read from TRefArray files (not persisted). */
+            std::vector<unsigned int> parentUIDs_; //!
 
             /** Encoding of Geant4 process type. */
             int processType_{-1};
@@ -366,7 +429,7 @@ namespace ldmx {
             /**
              * ROOT class definition.
              */
-            ClassDef(SimParticle, 5);
+            ClassDef(SimParticle, 6);
     };
 
 }
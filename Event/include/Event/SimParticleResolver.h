@@ -0,0 +1,99 @@
+/**
+ * @file SimParticleResolver.h
+ * @brief Class that resolves track ID links to SimParticle objects
+ * @author Jeremy McCormick, SLAC National Accelerator Laboratory
+ */
+
+#ifndef EVENT_SIMPARTICLERESOLVER_H_
+#define EVENT_SIMPARTICLERESOLVER_H_
+
+//----------//
+//   ROOT   //
+//----------//
+#include "TClonesArray.h"
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <unordered_map>
+
+namespace ldmx {
+
+    class SimParticle;
+
+    /**
+     * @class SimParticleResolver
+     * @brief Resolves persisted track ID links to SimParticle pointers
+     *
+     * @note
+     * SimParticle, SimCalorimeterHit, SimTrackerHit and FindableTrackResult
+     * store the track IDs of the particles they refer to.  The resolver builds
+     * a track ID lookup from the SimParticles collection once per event and
+     * fills the transient pointers of any collection holding one of those
+     * classes.  Objects read from files written with TRef links carry the
+     * reference UIDs instead (see EventLinkDef.h), which are mapped back to
+     * track IDs through the unique IDs of the particles.
+     */
+    class SimParticleResolver {
+
+        public:
+
+            /**
+             * Build the lookup from a SimParticle collection and resolve the 
+             * parent and daughter links of the particles.
+             * @param particles The SimParticle collection (may be null).
+             */
+            void build(TClonesArray* particles);
+
+            /**
+             * Reset the lookup.
+             */
+            void clear();
+
+            /**
+             * Find a SimParticle by its track ID.
+             * @param trackID The track ID of the particle.
+             * @return The particle or nullptr if it is not in the collection.
+             */
+            SimParticle* find(int trackID) const {
+                auto it = particles_.find(trackID);
+                return it == particles_.end() ? nullptr : it->second;
+            }
+
+            /**
+             * Resolve the links of every object in a collection.  Collections
+             * of classes without SimParticle links are left untouched.
+             * @param collection The collection to resolve.
+             */
+            void resolve(TClonesArray* collection);
+
+            /**
+             * @param cl The class of the objects in a collection.
+             * @return True if objects of the class link to SimParticles.
+             */
+            static bool hasLinks(const TClass* cl);
+
+        private:
+
+            /**
+             * Convert a TRef UID read from an old file to a track ID.
+             * @param uid The UID of the referenced particle.
+             * @return The track ID or -1 if the particle is not found.
+             */
+            int findLegacyTrackID(unsigned int uid);
+
+        private:
+
+            /** The SimParticle collection of the current event. */
+            TClonesArray* particleColl_{nullptr};
+
+            /** Map of track ID to particle. */
+            std::unordered_map<int, SimParticle*> particles_;
+
+            /** Map of TRef UID to track ID, only filled for old files. */
+            std::unordered_map<unsigned int, int> legacyTrackIDs_;
+    };
+
+}
+
+#endif
@@ -10,7 +10,6 @@
 
 // ROOT
 #include "TObject.h"
-#include "TRef.h"
 
 // LDMX
 #include "Event/SimParticle.h"
@@ -105,6 +104,27 @@ namespace ldmx {
              */
             std::vector<double> getMomentum() const { return {px_, py_, pz_}; };
 
+            /**
+             * Get the X momentum of the particle at the position at which
+             * the hit took place [MeV].
+             * @return The X momentum of the particle.
+             */
+            float getPx() const { return px_; };
+
+            /**
+             * Get the Y momentum of the particle at the position at which
+             * the hit took place [MeV].
+             * @return The Y momentum of the particle.
+             */
+            float getPy() const { return py_; };
+
+            /**
+             * Get the Z momentum of the particle at the position at which
+             * the hit took place [MeV].
+             * @return The Z momentum of the particle.
+             */
+            float getPz() const { return pz_; };
+
             /**
              * Get the Sim particle track ID of the hit.
              * @return The Sim particle track ID of the hit.
@@ -119,9 +139,18 @@ namespace ldmx {
 
             /**
              * Get the Monte Carlo particle that created the hit.
-             * @return The particle that created the hit.
+             * @return The particle that created the hit or nullptr if
+             *         it was not saved or the link is not resolved.
              */
-            SimParticle* getSimParticle() const;
+            SimParticle* getSimParticle() const { return simParticle_; }
+
+            /**
+             * Get the track ID of the SimParticle associated with the hit.
+             * This may differ from getTrackID() when the track that made the
+             * hit was not saved and the hit is assigned to an ancestor.
+             * @return The track ID of the associated SimParticle or -1 if none.
+             */
+            int getSimParticleTrackID() const { return simParticleTrackID_; }
 
             /**
              * Set the detector ID of the hit.
@@ -199,7 +228,16 @@ namespace ldmx {
              * Set the Monte Carlo particle that created the hit.
              * @param simParticle The particle that created the hit.
              */
-            void setSimParticle(SimParticle* simParticle) { this->simParticle_ = (TObject*) simParticle; };
+            void setSimParticle(SimParticle* simParticle) { 
+                this->simParticle_ = simParticle; 
+                this->simParticleTrackID_ = simParticle ? simParticle->getTrackID() : -1;
+            };
+
+            /**
+             * Fill the transient SimParticle pointer from the persisted track ID.
+             * @param resolver The track ID lookup for the current event.
+             */
+            void resolveLinks(const SimParticleResolver& resolver);
 
         private:
 
@@ -277,14 +315,27 @@ namespace ldmx {
             int pdgID_{0};
 
             /**
-             * The particle that caused the hit.
+             * The track ID of the particle that caused the hit.
+             */
+            int simParticleTrackID_{-1};
+
+            /**
+             * The particle that caused the hit (not persisted).
+             */
+            SimParticle* simParticle_{nullptr}; //!
+
+            /**
+             * Reference UID of the particle read from files written with a 
+             * TRef link, converted to a track ID by the resolver (not persisted).
              */
-            TRef simParticle_{nullptr};
+            unsigned int simParticleUID_{0}; //!
+
+            friend class SimParticleResolver;
 
             /**
              * The ROOT class definition.
              */
-            ClassDef(SimTrackerHit, 3);
+            ClassDef(SimTrackerHit, 4);
 
     }; // SimTrackerHit
 
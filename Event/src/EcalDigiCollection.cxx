@@ -0,0 +1,114 @@
+#include "Event/EcalDigiCollection.h"
+
+// STL
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+ClassImp(ldmx::EcalDigiCollection)
+
+namespace ldmx {
+
+    void EcalDigiCollection::Clear(Option_t *option) {
+        TObject::Clear();
+        nHits_ = 0;
+        data_.clear();
+        hits_.clear();
+        decoded_ = false;
+    }
+
+    void EcalDigiCollection::Copy(TObject& object) const {
+        EcalDigiCollection& collection = (EcalDigiCollection&) object;
+        collection.energyPrecision_ = energyPrecision_;
+        collection.timePrecision_ = timePrecision_;
+        collection.nHits_ = nHits_;
+        collection.data_ = data_;
+        collection.hits_.clear();
+        collection.decoded_ = false;
+    }
+
+    void EcalDigiCollection::Print(Option_t *option) const {
+        std::cout << "EcalDigiCollection { hits: " << nHits_ << ", bytes: " << data_.size()
+                << ", energy precision: " << energyPrecision_ << " MeV, time precision: "
+                << timePrecision_ << " ns }" << std::endl;
+    }
+
+    void EcalDigiCollection::pack(const TClonesArray* hits) {
+
+        Clear();
+
+        std::vector<const EcalHit*> sorted;
+        sorted.reserve(hits->GetEntriesFast());
+        for (int iHit = 0; iHit < hits->GetEntriesFast(); ++iHit) {
+            sorted.push_back(static_cast<const EcalHit*>(hits->At(iHit)));
+        }
+        std::stable_sort(sorted.begin(), sorted.end(), [](const EcalHit* a, const EcalHit* b) {
+            return uint32_t(a->getID()) < uint32_t(b->getID());
+        });
+
+        // Most hits take a few bytes per field.
+        data_.reserve(8 * sorted.size());
+        uint32_t previousID = 0;
+        for (const EcalHit* hit : sorted) {
+            uint32_t id = hit->getID();
+            putVarint((uint64_t(id - previousID) << 1) | (hit->isNoise() ? 1 : 0));
+            putVarint(zigzag(toFixed(hit->getAmplitude(), energyPrecision_)));
+            putVarint(zigzag(toFixed(hit->getEnergy(), energyPrecision_)));
+            putVarint(zigzag(toFixed(hit->getTime(), timePrecision_)));
+            previousID = id;
+        }
+        nHits_ = sorted.size();
+    }
+
+    const std::vector<EcalHit>& EcalDigiCollection::getHits() const {
+        if (decoded_) {
+            return hits_;
+        }
+        hits_.resize(nHits_);
+        std::size_t position = 0;
+        uint32_t id = 0;
+        for (EcalHit& hit : hits_) {
+            uint64_t idWord = getVarint(position);
+            id += uint32_t(idWord >> 1);
+            hit.setID(id);
+            hit.setNoiseHit(idWord & 1);
+            hit.setAmplitude(unzigzag(getVarint(position)) * energyPrecision_);
+            hit.setEnergy(unzigzag(getVarint(position)) * energyPrecision_);
+            hit.setTime(unzigzag(getVarint(position)) * timePrecision_);
+        }
+        decoded_ = true;
+        return hits_;
+    }
+
+    void EcalDigiCollection::unpack(TClonesArray* hits) const {
+        hits->Clear("C");
+        const std::vector<EcalHit>& decoded = getHits();
+        for (std::size_t iHit = 0; iHit < decoded.size(); ++iHit) {
+            *static_cast<EcalHit*>(hits->ConstructedAt(iHit)) = decoded[iHit];
+        }
+    }
+
+    void EcalDigiCollection::putVarint(uint64_t value) {
+        while (value >= 0x80) {
+            data_.push_back((value & 0x7F) | 0x80);
+            value >>= 7;
+        }
+        data_.push_back(value);
+    }
+
+    uint64_t EcalDigiCollection::getVarint(std::size_t& position) const {
+        uint64_t value = 0;
+        for (int shift = 0; position < data_.size(); shift += 7) {
+            unsigned char byte = data_[position++];
+            value |= uint64_t(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                break;
+            }
+        }
+        return value;
+    }
+
+    int32_t EcalDigiCollection::toFixed(float value, float precision) {
+        return int32_t(std::lround(value / precision));
+    }
+}
@@ -6,6 +6,7 @@
  */
 
 #include "Event/FindableTrackResult.h"
+#include "Event/SimParticleResolver.h"
 
 ClassImp(ldmx::FindableTrackResult)
 
@@ -44,7 +45,9 @@ namespace ldmx {
     }
 
     void FindableTrackResult::Clear(Option_t *option) { 
+        simParticleTrackID_ = -1;
         simParticle_    = nullptr;
+        simParticleUID_ = 0;
         is4sFindable_   = false; 
         is3s1aFindable_ = false;
         is2s2aFindable_ = false;
@@ -53,10 +56,14 @@ namespace ldmx {
         is3sFindable_   = false;
     }
 
+    void FindableTrackResult::resolveLinks(const SimParticleResolver& resolver) { 
+        simParticle_ = resolver.find(simParticleTrackID_);
+    }
+
     void FindableTrackResult::Print(Option_t *option) { 
         std::cout << "[ FindableTrackResult ]: "
-                  << "Sim particle PDG ID: " 
-                  << static_cast<SimParticle*>(simParticle_.GetObject())->getPdgID() << "\n" 
+                  << "Sim particle track ID: " 
+                  << simParticleTrackID_ << "\n" 
                   << "\t4s Findable: "   << is4sFindable_    << "\n" 
                   << "\t3s1a Findable: " << is3s1aFindable_  << "\n"
                   << "\t2s2a Findable: " << is2s2aFindable_  << "\n"
@@ -0,0 +1,92 @@
+#include "Event/HitColumns.h"
+
+// LDMX
+#include "Event/CalorimeterHit.h"
+#include "Event/HcalHit.h"
+#include "Event/SimCalorimeterHit.h"
+#include "Event/SimTrackerHit.h"
+
+// STL
+#include <iostream>
+
+ClassImp(ldmx::HitColumns)
+
+namespace ldmx {
+
+    void HitColumns::Clear(Option_t *option) {
+        TObject::Clear();
+        id_.clear();
+        energy_.clear();
+        amplitude_.clear();
+        minAmplitude_.clear();
+        time_.clear();
+        x_.clear();
+        y_.clear();
+        z_.clear();
+    }
+
+    void HitColumns::Copy(TObject& object) const {
+        HitColumns& columns = (HitColumns&) object;
+        columns.id_ = id_;
+        columns.energy_ = energy_;
+        columns.amplitude_ = amplitude_;
+        columns.minAmplitude_ = minAmplitude_;
+        columns.time_ = time_;
+        columns.x_ = x_;
+        columns.y_ = y_;
+        columns.z_ = z_;
+    }
+
+    void HitColumns::Print(Option_t *option) const {
+        std::cout << "HitColumns { hits: " << size() << " }" << std::endl;
+    }
+
+    void HitColumns::reserve(std::size_t nHits) {
+        id_.reserve(nHits);
+        energy_.reserve(nHits);
+        amplitude_.reserve(nHits);
+        minAmplitude_.reserve(nHits);
+        time_.reserve(nHits);
+        x_.reserve(nHits);
+        y_.reserve(nHits);
+        z_.reserve(nHits);
+    }
+
+    bool HitColumns::fill(const TClonesArray* hits) {
+
+        Clear();
+
+        int nHits = hits->GetEntriesFast();
+        reserve(nHits);
+
+        TClass* hitClass = hits->GetClass();
+        if (hitClass->InheritsFrom(HcalHit::Class())) {
+            for (int iHit = 0; iHit < nHits; ++iHit) {
+                const HcalHit* hit = static_cast<const HcalHit*>(hits->At(iHit));
+                addHit(hit->getID(), hit->getEnergy(), hit->getAmplitude(), hit->getTime(),
+                        hit->getX(), hit->getY(), hit->getZ(), hit->getMinPE());
+            }
+        } else if (hitClass->InheritsFrom(CalorimeterHit::Class())) {
+            for (int iHit = 0; iHit < nHits; ++iHit) {
+                const CalorimeterHit* hit = static_cast<const CalorimeterHit*>(hits->At(iHit));
+                addHit(hit->getID(), hit->getEnergy(), hit->getAmplitude(), hit->getTime());
+            }
+        } else if (hitClass->InheritsFrom(SimCalorimeterHit::Class())) {
+            for (int iHit = 0; iHit < nHits; ++iHit) {
+                SimCalorimeterHit* hit = static_cast<SimCalorimeterHit*>(hits->At(iHit));
+                std::vector<float> position = hit->getPosition();
+                addHit(hit->getID(), hit->getEdep(), hit->getEdep(), hit->getTime(), position[0], position[1], position[2]);
+            }
+        } else if (hitClass->InheritsFrom(SimTrackerHit::Class())) {
+            for (int iHit = 0; iHit < nHits; ++iHit) {
+                const SimTrackerHit* hit = static_cast<const SimTrackerHit*>(hits->At(iHit));
+                std::vector<float> position = hit->getPosition();
+                addHit(hit->getID(), hit->getEdep(), hit->getEdep(), hit->getTime(), position[0], position[1], position[2]);
+            }
+        } else {
+            return false;
+        }
+
+        return true;
+    }
+}
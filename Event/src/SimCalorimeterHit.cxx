@@ -1,5 +1,8 @@
 #include "Event/SimCalorimeterHit.h"
 
+// LDMX
+#include "Event/SimParticleResolver.h"
+
 // STL
 #include <iostream>
 
@@ -8,20 +11,20 @@ ClassImp(ldmx::SimCalorimeterHit)
 namespace ldmx {
 
     SimCalorimeterHit::SimCalorimeterHit()
-        : TObject(), simParticleContribs_(new TRefArray) {
+        : TObject() {
     }
 
     SimCalorimeterHit::~SimCalorimeterHit() {
         TObject::Clear();
-        delete simParticleContribs_;
-        simParticleContribs_ = 0;
     }
 
     void SimCalorimeterHit::Clear(Option_t *option) {
 
         TObject::Clear();
 
-        simParticleContribs_->Delete();
+        trackIDContribs_.clear();
+        simParticleContribs_.clear();
+        contribUIDs_.clear();
         pdgCodeContribs_.clear();
         edepContribs_.clear();
         timeContribs_.clear();
@@ -41,7 +44,8 @@ namespace ldmx {
     }
 
     void SimCalorimeterHit::addContrib(SimParticle* simParticle, int pdgCode, float edep, float time) {
-        simParticleContribs_->Add(simParticle);
+        trackIDContribs_.push_back(simParticle ? simParticle->getTrackID() : -1);
+        simParticleContribs_.push_back(simParticle);
         pdgCodeContribs_.push_back(pdgCode);
         edepContribs_.push_back(edep);
         timeContribs_.push_back(time);
@@ -54,7 +58,8 @@ namespace ldmx {
 
     SimCalorimeterHit::Contrib SimCalorimeterHit::getContrib(int i) {
         Contrib contrib;
-        contrib.particle = (SimParticle*) simParticleContribs_->At(i);
+        contrib.trackID = trackIDContribs_[i];
+        contrib.particle = i < simParticleContribs_.size() ? simParticleContribs_[i] : nullptr;
         contrib.edep = edepContribs_[i];
         contrib.time = timeContribs_[i];
         contrib.pdgCode = pdgCodeContribs_[i];
@@ -63,9 +68,9 @@ namespace ldmx {
 
     int SimCalorimeterHit::findContribIndex(SimParticle* simParticle, int pdgCode) {
         int contribIndex = -1;
+        int trackID = simParticle ? simParticle->getTrackID() : -1;
         for (int iContrib = 0; iContrib < nContribs_; iContrib++) {
-            Contrib contrib = getContrib(iContrib);
-            if (contrib.particle == simParticle && contrib.pdgCode == pdgCode) {
+            if (trackIDContribs_[iContrib] == trackID && pdgCodeContribs_[iContrib] == pdgCode) {
                 contribIndex = iContrib;
                 break;
             }
@@ -81,5 +86,12 @@ namespace ldmx {
         edep_ += edep;
     }
 
+    void SimCalorimeterHit::resolveLinks(const SimParticleResolver& resolver) {
+        simParticleContribs_.resize(trackIDContribs_.size());
+        for (int i = 0; i < trackIDContribs_.size(); ++i) {
+            simParticleContribs_[i] = resolver.find(trackIDContribs_[i]);
+        }
+    }
+
 
 }
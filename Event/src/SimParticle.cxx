@@ -8,6 +8,9 @@
 
 #include "Event/SimParticle.h"
 
+// LDMX
+#include "Event/SimParticleResolver.h"
+
 //----------------//
 //   C++ StdLib   //
 //----------------//
@@ -34,21 +37,26 @@ namespace ldmx {
 
     SimParticle::ProcessTypeMap SimParticle::PROCESS_MAP = SimParticle::createProcessTypeMap();
 
+    const std::string SimParticle::ECAL_PARTICLE_FLAGS = "ecalParticleFlags";
+
     SimParticle::SimParticle()
-        : TObject(), daughters_(new TRefArray()), parents_(new TRefArray()) {
+        : TObject() {
     }
 
     SimParticle::~SimParticle() {
         TObject::Clear();
-        delete daughters_;
-        delete parents_;
     }
 
     void SimParticle::Clear(Option_t *option) {
         TObject::Clear();
+        ResetBit(ECAL_HITS_BIT);
 
-        daughters_->Delete();
-        parents_->Delete();
+        daughterTrackIDs_.clear();
+        parentTrackIDs_.clear();
+        daughters_.clear();
+        parents_.clear();
+        daughterUIDs_.clear();
+        parentUIDs_.clear();
 
         energy_ = 0;
         trackID_ = -1;
@@ -84,12 +92,23 @@ namespace ldmx {
                 "momentum: ( " << px_ << ", " << py_ << ", " << pz_ << " ), " <<
                 "endPointMomentum: ( " << endpx_ << ", " << endpy_ << ", " << endpz_ << " ), " <<
                 "mass: " << mass_ << ", " <<
-                "nDaughters: " << daughters_->GetEntries() << ", "
-                "nParents: " << parents_->GetEntries() << ", "
+                "nDaughters: " << daughterTrackIDs_.size() << ", "
+                "nParents: " << parentTrackIDs_.size() << ", "
                 "processType: " << processType_ <<
                 " }" << std::endl;
     }
 
+    void SimParticle::resolveLinks(const SimParticleResolver& resolver) {
+        daughters_.resize(daughterTrackIDs_.size());
+        for (int i = 0; i < daughterTrackIDs_.size(); ++i) {
+            daughters_[i] = resolver.find(daughterTrackIDs_[i]);
+        }
+        parents_.resize(parentTrackIDs_.size());
+        for (int i = 0; i < parentTrackIDs_.size(); ++i) {
+            parents_[i] = resolver.find(parentTrackIDs_[i]);
+        }
+    }
+
     SimParticle::ProcessType SimParticle::findProcessType(std::string processName) {
 
         if (processName.find("biasWrapper") != std::string::npos) { 
@@ -97,8 +116,9 @@ namespace ldmx {
             processName = processName.substr(pos, processName.size() - pos - 1); 
         }  
                 
-        if (PROCESS_MAP.find(processName) != PROCESS_MAP.end()) {
-            return PROCESS_MAP[processName];
+        auto it = PROCESS_MAP.find(processName);
+        if (it != PROCESS_MAP.end()) {
+            return it->second;
         } else {
             return ProcessType::unknown;
         }
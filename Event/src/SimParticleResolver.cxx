@@ -0,0 +1,104 @@
+#include "Event/SimParticleResolver.h"
+
+// LDMX
+#include "Event/FindableTrackResult.h"
+#include "Event/SimCalorimeterHit.h"
+#include "Event/SimParticle.h"
+#include "Event/SimTrackerHit.h"
+
+namespace ldmx {
+
+    void SimParticleResolver::build(TClonesArray* particles) {
+        clear();
+        particleColl_ = particles;
+        if (!particles) return;
+
+        int nParticles = particles->GetEntriesFast();
+        particles_.reserve(nParticles);
+        for (int iParticle = 0; iParticle < nParticles; ++iParticle) {
+            SimParticle* particle = static_cast<SimParticle*>(particles->At(iParticle));
+            particles_[particle->getTrackID()] = particle;
+        }
+
+        resolve(particles);
+    }
+
+    void SimParticleResolver::clear() {
+        particleColl_ = nullptr;
+        particles_.clear();
+        legacyTrackIDs_.clear();
+    }
+
+    bool SimParticleResolver::hasLinks(const TClass* cl) {
+        return cl == SimParticle::Class() || cl == SimCalorimeterHit::Class()
+                || cl == SimTrackerHit::Class() || cl == FindableTrackResult::Class();
+    }
+
+    void SimParticleResolver::resolve(TClonesArray* collection) {
+        
+        const TClass* cl = collection->GetClass();
+        int n = collection->GetEntriesFast();
+
+        if (cl == SimParticle::Class()) {
+            for (int i = 0; i < n; ++i) {
+                SimParticle* particle = static_cast<SimParticle*>(collection->At(i));
+                if (!particle->daughterUIDs_.empty() || !particle->parentUIDs_.empty()) {
+                    particle->daughterTrackIDs_.clear();
+                    for (unsigned int uid : particle->daughterUIDs_) 
+                        particle->daughterTrackIDs_.push_back(findLegacyTrackID(uid));
+                    particle->parentTrackIDs_.clear();
+                    for (unsigned int uid : particle->parentUIDs_) 
+                        particle->parentTrackIDs_.push_back(findLegacyTrackID(uid));
+                    particle->daughterUIDs_.clear();
+                    particle->parentUIDs_.clear();
+                }
+                particle->resolveLinks(*this);
+            }
+        } else if (cl == SimCalorimeterHit::Class()) {
+            for (int i = 0; i < n; ++i) {
+                SimCalorimeterHit* hit = static_cast<SimCalorimeterHit*>(collection->At(i));
+                if (!hit->contribUIDs_.empty()) {
+                    hit->trackIDContribs_.clear();
+                    for (unsigned int uid : hit->contribUIDs_) 
+                        hit->trackIDContribs_.push_back(findLegacyTrackID(uid));
+                    hit->contribUIDs_.clear();
+                }
+                hit->resolveLinks(*this);
+            }
+        } else if (cl == SimTrackerHit::Class()) {
+            for (int i = 0; i < n; ++i) {
+                SimTrackerHit* hit = static_cast<SimTrackerHit*>(collection->At(i));
+                if (hit->simParticleUID_ != 0) {
+                    hit->simParticleTrackID_ = findLegacyTrackID(hit->simParticleUID_);
+                    hit->simParticleUID_ = 0;
+                }
+                hit->resolveLinks(*this);
+            }
+        } else if (cl == FindableTrackResult::Class()) {
+            for (int i = 0; i < n; ++i) {
+                FindableTrackResult* result = static_cast<FindableTrackResult*>(collection->At(i));
+                if (result->simParticleUID_ != 0) {
+                    result->simParticleTrackID_ = findLegacyTrackID(result->simParticleUID_);
+                    result->simParticleUID_ = 0;
+                }
+                result->resolveLinks(*this);
+            }
+        }
+    }
+
+    int SimParticleResolver::findLegacyTrackID(unsigned int uid) {
+        if (uid == 0 || !particleColl_) return -1;
+
+        // The UID table is only needed for old files so build it on first use.
+        if (legacyTrackIDs_.empty()) {
+            for (int i = 0; i < particleColl_->GetEntriesFast(); ++i) {
+                SimParticle* particle = static_cast<SimParticle*>(particleColl_->At(i));
+                legacyTrackIDs_[particle->GetUniqueID() & 0xffffff] = particle->getTrackID();
+            }
+        }
+
+        auto it = legacyTrackIDs_.find(uid & 0xffffff);
+        return it == legacyTrackIDs_.end() ? -1 : it->second;
+    }
+
+}
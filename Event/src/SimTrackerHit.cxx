@@ -1,5 +1,8 @@
 #include "Event/SimTrackerHit.h"
 
+// LDMX
+#include "Event/SimParticleResolver.h"
+
 ClassImp(ldmx::SimTrackerHit)
 
 namespace ldmx {
@@ -41,11 +44,13 @@ namespace ldmx {
         trackID_ = -1;
         pdgID_ = 0;
 
+        simParticleTrackID_ = -1;
         simParticle_ = nullptr;
+        simParticleUID_ = 0;
     }
 
-    SimParticle* SimTrackerHit::getSimParticle() const {
-        return static_cast<SimParticle*>(simParticle_.GetObject());
+    void SimTrackerHit::resolveLinks(const SimParticleResolver& resolver) {
+        simParticle_ = resolver.find(simParticleTrackID_);
     }
 
     void SimTrackerHit::setPosition(const float x, const float y, const float z) {
@@ -0,0 +1,150 @@
+// LDMX
+#include "Event/EcalDigiCollection.h"
+#include "Event/EcalHit.h"
+
+// ROOT
+#include "TClonesArray.h"
+#include "TFile.h"
+#include "TTree.h"
+
+// STL
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ldmx;
+
+/** The fields of a hit which are stored by the collection. */
+struct HitValues {
+    unsigned id;
+    bool noise;
+    float amplitude;
+    float energy;
+    float time;
+};
+
+/**
+ * Make hits with IDs in no particular order, values on the fixed-point grid
+ * and negative values, both near each other and with large ID gaps.
+ */
+std::vector<HitValues> makeHits(int seed, int nHits) {
+    std::vector<HitValues> hits;
+    for (int iHit = 0; iHit < nHits; ++iHit) {
+        unsigned cell = (iHit * 37 + seed * 11) % 400;
+        unsigned module = (iHit + seed) % 7;
+        unsigned layer = (iHit * 5 + seed) % 34;
+        HitValues hit;
+        hit.id = (cell << 15) | (module << 12) | (layer << 4) | 1;
+        hit.noise = (iHit + seed) % 5 == 0;
+        hit.amplitude = 0.001 * ((iHit + 1) * 137 + seed);
+        hit.energy = 0.001 * ((iHit + 1) * 2311 - 500 * seed);
+        hit.time = 0.01 * ((iHit * 91 + seed * 7) % 2000 - 300);
+        hits.push_back(hit);
+    }
+
+    // Drop duplicate IDs, the collection keeps one hit per cell.
+    std::sort(hits.begin(), hits.end(), [](const HitValues& a, const HitValues& b) { return a.id < b.id; });
+    hits.erase(std::unique(hits.begin(), hits.end(), [](const HitValues& a, const HitValues& b) { return a.id == b.id; }),
+            hits.end());
+    std::reverse(hits.begin(), hits.end());
+    return hits;
+}
+
+void fill(TClonesArray* array, const std::vector<HitValues>& hits) {
+    array->Clear("C");
+    for (std::size_t iHit = 0; iHit < hits.size(); ++iHit) {
+        EcalHit* hit = static_cast<EcalHit*>(array->ConstructedAt(iHit));
+        hit->setID(hits[iHit].id);
+        hit->setNoiseHit(hits[iHit].noise);
+        hit->setAmplitude(hits[iHit].amplitude);
+        hit->setEnergy(hits[iHit].energy);
+        hit->setTime(hits[iHit].time);
+    }
+}
+
+/** Check that the decoded hits are the input hits sorted by ID, within half a count. */
+void check(const EcalDigiCollection& collection, std::vector<HitValues> expected, const std::string& what) {
+
+    std::sort(expected.begin(), expected.end(), [](const HitValues& a, const HitValues& b) { return a.id < b.id; });
+
+    const std::vector<EcalHit>& hits = collection.getHits();
+    if (hits.size() != expected.size() || collection.getNumberOfHits() != (int) expected.size()) {
+        throw std::runtime_error(what + ": expected " + std::to_string(expected.size()) + " hits but got "
+                + std::to_string(hits.size()));
+    }
+
+    float energyTolerance = collection.getEnergyPrecision() / 2;
+    float timeTolerance = collection.getTimePrecision() / 2;
+    for (std::size_t iHit = 0; iHit < hits.size(); ++iHit) {
+        const EcalHit& hit = hits[iHit];
+        const HitValues& values = expected[iHit];
+        if ((unsigned) hit.getID() != values.id || hit.isNoise() != values.noise
+                || std::fabs(hit.getAmplitude() - values.amplitude) > energyTolerance
+                || std::fabs(hit.getEnergy() - values.energy) > energyTolerance
+                || std::fabs(hit.getTime() - values.time) > timeTolerance) {
+            throw std::runtime_error(what + ": hit " + std::to_string(iHit) + " with ID " + std::to_string(values.id)
+                    + " was not decoded unchanged");
+        }
+    }
+    std::cout << what << ": " << hits.size() << " hits in " << collection.getEncodedSize() << " bytes okay" << std::endl;
+}
+
+/**
+ * Pack hits into an EcalDigiCollection and check that getHits() returns
+ * them unchanged, both directly and after every entry of a tree is read
+ * into the same collection object.
+ */
+int main() {
+
+    std::cout << "Hello EcalDigiCollection test!" << std::endl;
+
+    TClonesArray* array = new TClonesArray("ldmx::EcalHit", 100);
+
+    // Packing again replaces the hits decoded before.
+    EcalDigiCollection collection;
+    check(collection, {}, "Empty collection");
+    std::vector<HitValues> first = makeHits(1, 50);
+    fill(array, first);
+    collection.pack(array);
+    check(collection, first, "Packed hits");
+    std::vector<HitValues> second = makeHits(2, 80);
+    fill(array, second);
+    collection.pack(array);
+    check(collection, second, "Packed hits again");
+
+    // Each entry read into the same object must be decoded again.
+    const std::string fileName = "ecal_digi_collection_test.root";
+    const int nEntries = 4;
+    {
+        TFile file(fileName.c_str(), "RECREATE");
+        TTree tree("digis", "digis");
+        EcalDigiCollection* output = new EcalDigiCollection();
+        tree.Branch("EcalDigis", &output);
+        for (int iEntry = 0; iEntry < nEntries; ++iEntry) {
+            fill(array, makeHits(iEntry, 20 + 10 * iEntry));
+            output->pack(array);
+            tree.Fill();
+        }
+        tree.Write();
+        delete output;
+    }
+    {
+        TFile file(fileName.c_str());
+        TTree* tree = static_cast<TTree*>(file.Get("digis"));
+        EcalDigiCollection* input = new EcalDigiCollection();
+        tree->SetBranchAddress("EcalDigis", &input);
+        for (int iEntry = 0; iEntry < nEntries; ++iEntry) {
+            tree->GetEntry(iEntry);
+            check(*input, makeHits(iEntry, 20 + 10 * iEntry), "Entry " + std::to_string(iEntry));
+        }
+        delete tree;
+        delete input;
+    }
+
+    delete array;
+
+    std::cout << "Bye EcalDigiCollection test!" << std::endl;
+}
@@ -29,6 +29,7 @@
 #include "Event/SimTrackerHit.h"
 #include "Event/EcalCluster.h"
 #include "Event/SimParticle.h"
+#include "Event/SimParticleResolver.h"
 #include "EventDisplay/EventDisplay.h"
 
 #include <iostream>
@@ -60,6 +61,8 @@ namespace ldmx {
 
             bool GetEcalSimParticlesColl(const char* ecalSimParticlesCollName);
 
+            bool GetSimParticlesColl(const char* simParticlesCollName);
+
             bool GotoEvent(int event);
 
             bool GotoEvent();
@@ -94,6 +97,8 @@ namespace ldmx {
             TClonesArray* recoilHits_;
             TClonesArray* ecalClusters_;
             TClonesArray* ecalSimParticles_;
+            TClonesArray* simParticles_;
+            SimParticleResolver resolver_; //!
 
             bool foundECALDigis_ = false;
             bool foundClusters_ = false;
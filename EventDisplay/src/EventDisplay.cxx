@@ -146,6 +146,16 @@ namespace ldmx {
         }
     }
 
+    bool EventDisplay::GetSimParticlesColl(const char* simParticlesCollName = "SimParticles_sim") {
+        if (tree_->GetListOfBranches()->FindObject(simParticlesCollName)) {
+            tree_->SetBranchAddress(simParticlesCollName, &simParticles_);
+            return true;
+        } else {
+            std::cout << "No branch with name \"" << simParticlesCollName << "\"" << std::endl;
+            return false;
+        }
+    }
+
     bool EventDisplay::SetFile(const char* file) {
 
         file_ = TFile::Open(file);
@@ -169,11 +179,16 @@ namespace ldmx {
         recoilHits_ = new TClonesArray("ldmx::SimTrackerHit");
         ecalClusters_ = new TClonesArray("ldmx::EcalCluster");
         ecalSimParticles_ = new TClonesArray("ldmx::SimTrackerHit");
+        simParticles_ = new TClonesArray("ldmx::SimParticle");
 
         foundECALDigis_ = GetECALDigisColl();
         foundClusters_ = GetClustersColl(clustersCollName_);
         foundTrackerHits_ = GetTrackerHitsColl();
         foundEcalSPHits_ = GetEcalSimParticlesColl();
+        if (foundEcalSPHits_) {
+            // the scoring plane hits only store the track ID of their particle
+            foundEcalSPHits_ = GetSimParticlesColl();
+        }
 
         return true;
     }
@@ -211,6 +226,8 @@ namespace ldmx {
         }
 
         if (foundEcalSPHits_) {
+            resolver_.build(simParticles_);
+            resolver_.resolve(ecalSimParticles_);
             TEveElement* ecalSimParticleHitSet = drawECALSimParticles(ecalSimParticles_);
             hits_->AddElement(ecalSimParticleHitSet);
         }
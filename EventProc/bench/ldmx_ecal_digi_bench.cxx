@@ -0,0 +1,194 @@
+/**
+ * @file ldmx_ecal_digi_bench.cxx
+ * @brief Benchmark of the ECal digitization of sim hits
+ *
+ * @note
+ * The per-hit loop of the EcalDigiProducer is timed against the previous
+ * implementation, which unpacked the layer through EcalDetectorID, looked up
+ * the layer weight and drew the noise of each hit with a separate call.  Both
+ * run over the same synthetic sim hits on real ECal channels.
+ */
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//----------//
+//   ROOT   //
+//----------//
+#include "TClonesArray.h"
+#include "TRandom3.h"
+
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "DetDescr/EcalDetectorID.h"
+#include "Event/EcalHit.h"
+#include "Event/EventConstants.h"
+#include "Event/SimCalorimeterHit.h"
+#include "EventProc/EcalDigiProducer.h"
+#include "Framework/ParameterSet.h"
+#include "Framework/Process.h"
+
+using namespace ldmx;
+
+namespace {
+
+    /** ECal readout dimensions, matching the EcalDigiProducer. */
+    const int ECAL_SUBDET_ID = 5;
+    const int ECAL_LAYERS = 34;
+    const int HEX_MODULES = 7;
+    const int CELLS_PER_MODULE = 397;
+
+    /** Calibration constants of the previous implementation. */
+    const double MIP_SI_RESPONSE = 0.130;
+    const double LAYER_WEIGHTS[ECAL_LAYERS] = {1.641, 3.526, 5.184, 6.841,
+        8.222, 8.775, 8.775, 8.775, 8.775, 8.775, 8.775, 8.775, 8.775, 8.775,
+        8.775, 8.775, 8.775, 8.775, 8.775, 8.775, 8.775, 8.775, 12.642, 16.51,
+        16.51, 16.51, 16.51, 16.51, 16.51, 16.51, 16.51, 16.51, 16.51, 8.45};
+
+    /** Configuration of the digitization, matching ecalDigis.py. */
+    const double NOISE_INTERCEPT = 900.;
+    const double NOISE_SLOPE = 22.;
+    const double PAD_CAPACITANCE = 27.56;
+    const double READOUT_THRESHOLD = 4.;
+
+    /** Place hits on random channels with an exponential energy spectrum. */
+    void fillSimHits(TClonesArray* simHits, int nHits, TRandom3& random) {
+        simHits->Clear("C");
+        EcalDetectorID detID;
+        detID.setFieldValue(0, ECAL_SUBDET_ID);
+        for (int iHit = 0; iHit < nHits; ++iHit) {
+            detID.setFieldValue(1, random.Integer(ECAL_LAYERS));
+            detID.setFieldValue(2, random.Integer(HEX_MODULES));
+            detID.setFieldValue(3, random.Integer(CELLS_PER_MODULE));
+            SimCalorimeterHit* hit = (SimCalorimeterHit*) simHits->ConstructedAt(iHit);
+            hit->setID(detID.pack());
+            hit->setEdep(random.Exp(0.5));
+            hit->setTime(random.Uniform(0, 20));
+        }
+    }
+
+    /** The per-hit loop of the previous implementation. */
+    void legacyDigitize(const TClonesArray* simHits, TClonesArray* digis, TRandom3& random,
+            EcalDetectorID& detID, double noiseRMS, double readoutThreshold) {
+        for (int iHit = 0; iHit < simHits->GetEntries(); iHit++) {
+
+            SimCalorimeterHit* simHit = (SimCalorimeterHit*) simHits->At(iHit);
+
+            double hitNoise = random.Gaus(0, noiseRMS);
+            detID.setRawValue(simHit->getID());
+            detID.unpack();
+            int layer = detID.getFieldValue("layer");
+
+            EcalHit* digiHit = (EcalHit*) (digis->ConstructedAt(iHit));
+
+            digiHit->setID(simHit->getID());
+            double energy = simHit->getEdep() + hitNoise;
+            digiHit->setAmplitude(energy);
+            if (energy > readoutThreshold) {
+                digiHit->setEnergy(((energy/MIP_SI_RESPONSE)*LAYER_WEIGHTS[layer]+energy)*0.948);
+                digiHit->setTime(simHit->getTime());
+            } else {
+                digiHit->setEnergy(0);
+                digiHit->setTime(-1000);
+            }
+        }
+    }
+
+    /** Parse a comma separated list of integers. */
+    std::vector<int> parseList(const char* arg) {
+        std::vector<int> values;
+        std::stringstream ss(arg);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            values.push_back(atoi(item.c_str()));
+        }
+        return values;
+    }
+
+    void printUsage() {
+        printf("Usage: ldmx-ecal-digi-bench [-n events] [-e ecalHits] [-s seed]\n");
+        printf("  The number of ECal sim hits may be a comma separated list to run a sweep.\n");
+    }
+}
+
+int main(int argc, char* argv[]) {
+
+    int nEvents{200};
+    unsigned seed{1};
+    std::vector<int> ecalHits{10000, 50000};
+
+    for (int iarg = 1; iarg < argc; iarg++) {
+        if (iarg + 1 == argc) {
+            printUsage();
+            return 1;
+        }
+        if (!strcmp(argv[iarg], "-n")) nEvents = atoi(argv[++iarg]);
+        else if (!strcmp(argv[iarg], "-s")) seed = atoi(argv[++iarg]);
+        else if (!strcmp(argv[iarg], "-e")) ecalHits = parseList(argv[++iarg]);
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    Process process("bench");
+    EcalDigiProducer producer("ecalDigis", process);
+    ParameterSet ps;
+    ps.insert("noiseIntercept", NOISE_INTERCEPT);
+    ps.insert("noiseSlope", NOISE_SLOPE);
+    ps.insert("padCapacitance", PAD_CAPACITANCE);
+    ps.insert("readoutThreshold", READOUT_THRESHOLD);
+    producer.configure(ps);
+
+    // Same noise and threshold as the producer, in MeV.
+    double noiseRMS = (NOISE_INTERCEPT + NOISE_SLOPE*PAD_CAPACITANCE)*(MIP_SI_RESPONSE/33000.0);
+    double readoutThreshold = READOUT_THRESHOLD*noiseRMS;
+
+    TRandom3 random(seed);
+    TRandom3 noiseRandom(seed + 1);
+    EcalDetectorID detID;
+    TClonesArray* simHits = new TClonesArray(EventConstants::SIM_CALORIMETER_HIT.c_str(), 50000);
+    TClonesArray* legacyDigis = new TClonesArray(EventConstants::ECAL_HIT.c_str(), 50000);
+
+    std::cout << std::fixed << std::setprecision(3);
+    for (int nHits : ecalHits) {
+
+        double legacyTime{0}, fusedTime{0};
+        for (int ievent = 0; ievent < nEvents; ++ievent) {
+            fillSimHits(simHits, nHits, random);
+
+            auto start = std::chrono::steady_clock::now();
+            legacyDigitize(simHits, legacyDigis, noiseRandom, detID, noiseRMS, readoutThreshold);
+            auto middle = std::chrono::steady_clock::now();
+            producer.digitizeSimHits(simHits);
+            auto end = std::chrono::steady_clock::now();
+
+            legacyTime += std::chrono::duration<double>(middle - start).count();
+            fusedTime += std::chrono::duration<double>(end - middle).count();
+
+            // Both outputs start empty in each event, as in the framework.
+            legacyDigis->Clear("C");
+            producer.clearDigis();
+        }
+
+        std::cout << "---- ldmx-ecal-digi-bench: " << nEvents << " events with " << nHits
+                  << " ECal sim hits --------" << std::endl;
+        std::cout << "  Previous loop: " << std::setw(12) << 1e6*legacyTime/nEvents << " us/event" << std::endl;
+        std::cout << "  Fused loop:    " << std::setw(12) << 1e6*fusedTime/nEvents << " us/event" << std::endl;
+        std::cout << "  Speedup:       " << std::setw(12) << ((fusedTime > 0) ? legacyTime/fusedTime : 0) << std::endl;
+    }
+
+    delete simHits;
+    delete legacyDigis;
+
+    return 0;
+}
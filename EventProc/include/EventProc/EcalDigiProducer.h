@@ -11,7 +11,9 @@
 //----------------//
 //   C++ StdLib   //
 //----------------//
+#include <cstdint>
 #include <time.h>
+#include <vector>
 
 //----------//
 //   ROOT   //
@@ -22,6 +24,7 @@
 //----------//
 //   LDMX   //
 //----------//
+#include "Event/EcalDigiCollection.h"
 #include "Event/EcalHit.h"
 #include "Event/EventConstants.h"
 #include "Event/SimCalorimeterHit.h"
@@ -54,7 +57,34 @@ namespace ldmx {
 
             virtual void produce(Event& event);
 
+            /**
+             * Digitize sim hits into the first entries of the digi collection
+             * and mark their channels as occupied, replacing the occupancy of
+             * the previous call.
+             *
+             * The layer is taken from the ID with a shift and mask, the noise
+             * of all hits is drawn up front and the calibrated energy comes
+             * from the per-layer gain table, so the loop makes no calls besides
+             * the inline hit accessors.
+             *
+             * @param simHits The ECal sim hits.
+             */
+            void digitizeSimHits(const TClonesArray* simHits);
+
+            /**
+             * Clear the digi collection, as the event does at the end of each 
+             * event, when digitizeSimHits is used outside of the framework.
+             */
+            void clearDigis() { ecalDigis_->Clear("C"); }
+
         private:
+
+            /**
+             * Draw the Gaussian noise of a number of hits into the noise buffer.
+             *
+             * @param nHits The number of hits.
+             */
+            void fillNoiseBuffer(int nHits);
             
             /** 
              * Calculate the noise in electrons given the pad capacitance. 
@@ -66,14 +96,21 @@ namespace ldmx {
                 return noiseIntercept + noiseSlope*capacitance;
             } 
             
-            inline layer_cell_pair hitToPair(SimCalorimeterHit* hit) {
-                int detIDraw = hit->getID();
-                detID_.setRawValue(detIDraw);
-                detID_.unpack();
-                int layer = detID_.getFieldValue("layer");
-                int cellid = detID_.getFieldValue("cell");
-                return (std::make_pair(layer, cellid));
-            }
+            /**
+             * Get the channel index of an ID.
+             *
+             * @param id The packed ECal ID.
+             * @return The index into channelIDs_ or -1 if the ID is outside of the readout.
+             */
+            int getChannel(int id) const;
+
+            /**
+             * Choose distinct empty channels for noise hits, sampling without
+             * replacement among the channels not marked in the occupancy bitmap.
+             *
+             * @param nNoise The number of noise hits.
+             */
+            void placeNoiseHits(int nNoise);
 
         private:
 
@@ -92,12 +129,51 @@ namespace ldmx {
             /** Total number of cells (channels) per hex module. */
             static const int CELLS_PER_HEX_MODULE{397};
 
+            /** Number of values of the layer field of the ID. */
+            static const int MAX_LAYER_FIELD{256};
+
             /** Total number of cells across all modules. */
             static const int TOTAL_CELLS{NUM_ECAL_LAYERS*HEX_MODULES_PER_LAYER*CELLS_PER_HEX_MODULE};
 
 
             TRandom3* noiseInjector_{new TRandom3(time(nullptr))};
             TClonesArray* ecalDigis_{nullptr};
+
+            /** Compact copy of the digis, added as ecalDigisCompact if enabled. */
+            EcalDigiCollection compactDigis_;
+
+            /** Flag indicating if the compact digi collection is added. */
+            bool compactOutput_{false};
+
+            /** Calibrated energy per MeV of amplitude for each layer. */
+            float gainSlope_[MAX_LAYER_FIELD];
+
+            /** Calibrated energy offset for each layer [MeV]. */
+            float gainOffset_[MAX_LAYER_FIELD];
+
+            /** Uniform random numbers used to draw the noise. */
+            std::vector<double> uniformBuffer_;
+
+            /** Noise of each sim hit of the current event [MeV]. */
+            std::vector<double> noiseBuffer_;
+
+            /** Packed ID of each channel, indexed by (layer*modules + module)*cells + cell. */
+            std::vector<int> channelIDs_;
+
+            /** One bit per channel holding a sim hit in the current event. */
+            std::vector<uint64_t> occupied_;
+
+            /** Channels marked in the occupancy bitmap in the current event. */
+            std::vector<int> occupiedChannels_;
+
+            /** One bit per free channel rank chosen for a noise hit. */
+            std::vector<uint64_t> chosen_;
+
+            /** Number of free channels before each word of the occupancy bitmap. */
+            std::vector<int> freeBefore_;
+
+            /** Channels of the noise hits of the current event. */
+            std::vector<int> noiseChannels_;
             EcalDetectorID detID_;
             EcalHexReadout* hexReadout_{nullptr};
           
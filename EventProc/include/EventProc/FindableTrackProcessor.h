@@ -22,6 +22,12 @@
 //----------//
 #include <TClonesArray.h>
 
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <utility>
+#include <vector>
+
 namespace ldmx { 
 
     class FindableTrackProcessor : public Producer { 
@@ -48,29 +54,51 @@ namespace ldmx {
              * @param event The event to process.
              */
             void produce(Event &event); 
+
+            /** 
+             * Given the layers hit by a sim particle, check if it is expected
+             * to fall within the acceptance of the recoil tracker.
+             *
+             * @param result The object used to encapsulate the results.
+             * @param layerMask Mask with bit n set if the (n + 1)th layer of
+             *                  the recoil tracker has a hit.
+             */
+            static void isFindable(FindableTrackResult* result, unsigned layerMask); 
             
         private:
 
             /**
-             * Create a hit map which associates a charged particle to it's 
-             * hits in the recoil tracker.
+             * Fill the layer hit mask of each sim particle from the hits in
+             * the recoil tracker.
              *
-             * @param recoilSimHit collection of simulated recoil tracker hits.
+             * @param simParticles collection of sim particles.
+             * @param siStripHits collection of digitized recoil tracker hits.
              */
-            void createHitMap(const TClonesArray* siStripHits);
-          
-            /** 
-             * Given a set of hits, check if a sim particle is expected to fall
-             * within the acceptance of the recoil tracker.
-             *
-             * @param result The object used to encapsulate the results.
-             * @param hitCount Vector indicating whether the nth layer of the 
-             *                 recoil tracker has a hit.
-             */
-            void isFindable(FindableTrackResult* result, std::vector<int> hitCount); 
+            void createHitMap(const TClonesArray* simParticles, const TClonesArray* siStripHits);
+
+            /** Number of layers in the recoil tracker. */
+            static const int RECOIL_LAYERS{10};
+
+            /** Bits of the first layer of the four stereo layer pairs. */
+            static const unsigned STEREO_PAIRS_MASK{0x55};
+
+            /** Bits of the first layer of the first two stereo pairs. */
+            static const unsigned FIRST_TWO_STEREO_MASK{0x05};
+
+            /** Bits of the first layer of the first three stereo pairs. */
+            static const unsigned FIRST_THREE_STEREO_MASK{0x15};
+
+            /** Bits of the two axial layers. */
+            static const unsigned AXIAL_MASK{0x300};
+
+            /** Sim particles sorted by address, with their index in the collection. */
+            std::vector<std::pair<const SimParticle*, int>> particleIndex_;
+
+            /** Mask of the recoil layers hit by each sim particle, by collection index. */
+            std::vector<unsigned> layerMask_;
 
-            /** Map between a sim particle and it's hit array. */ 
-            std::map<SimParticle*, std::vector<int>> hitMap_;
+            /** Number of recoil hits of each sim particle, by collection index. */
+            std::vector<int> hitCount_;
 
             /** Collection of results. */
             TClonesArray* findableTrackResults_{nullptr};
@@ -19,6 +19,7 @@
 #include "DetDescr/HcalID.h"
 #include "Event/EventConstants.h"
 #include "Event/HcalHit.h"
+#include "Event/HitColumns.h"
 #include "Event/SimCalorimeterHit.h"
 #include "Framework/EventProcessor.h"
 #include "Tools/NoiseGenerator.h"
@@ -54,6 +55,11 @@ namespace ldmx {
         private:
 
             TClonesArray* hits_{nullptr};
+
+            /** The digis as columns, added as hcalDigiColumns if enabled. */
+            HitColumns digiColumns_;
+            bool columnsOutput_{false};
+
             TRandom3* random_{new TRandom3(time(nullptr))};
             std::map<layer, zboundaries> hcalLayers_;
             bool verbose_{false};
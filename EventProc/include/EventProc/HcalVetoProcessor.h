@@ -11,6 +11,7 @@
 //   C++ StdLib   //
 //----------------//
 #include <string>
+#include <vector>
 
 //----------//
 //   LDMX   //
@@ -60,6 +61,15 @@ namespace ldmx {
             /** The minimum number of PE needed for a hit. */
             float minPE_{1}; 
 
+            /** 
+             * Name of the hits read as columns.  This is either hcalDigis or
+             * the columns written alongside it by the HcalDigiProducer.
+             */
+            std::string columnsName_{"hcalDigis"};
+
+            /** PE of each hit, or the lowest float if the hit is masked by the cuts. */
+            std::vector<float> maskedPE_;
+
     }; // HcalVetoProcessor
 }
 
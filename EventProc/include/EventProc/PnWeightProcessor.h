@@ -33,6 +33,7 @@
 //----------//
 #include "Event/PnWeightResult.h"
 #include "Event/SimParticle.h"
+#include "EventProc/PnWeightTable.h"
 #include "Framework/EventProcessor.h"
 
 //----------//
@@ -40,7 +41,6 @@
 //----------//
 #include "TTree.h"
 #include "TFile.h"
-#include "TF1.h"
 #include "TH1F.h"
 #include "TClonesArray.h"
 
@@ -87,7 +87,7 @@ namespace ldmx {
              * @param particle SimParticle used to calculate W.
              * @return W
              */
-            double calculateW(SimParticle* particle, double delta = 0.5);
+            double calculateW(const SimParticle* particle, double delta = 0.5);
 
         private:
     
@@ -100,11 +100,11 @@ namespace ldmx {
             /** Minimum angle for backwards-going hadron. */
             double thetaThreshold_{100 /* degrees */};
             
-            /** Fit to lower slope of inclusive W (theta > 100) plot. */
-            TF1* lFit{new TF1{"lfit","exp([1]-[0]*x)", 950, 1150}};  
-
-            /** Fit to high tail of inclusive W (theta > 100) plot. */
-            TF1* hFit{nullptr}; 
+            /** 
+             * Ratio of the fits to the lower slope and to the high tail of 
+             * the inclusive W (theta > 100) plot.
+             */
+            PnWeightTable weightTable_;
                 
     };
 }
@@ -0,0 +1,109 @@
+/**
+ * @file PnWeightTable.h
+ * @brief Class that tabulates the photonuclear W reweighting curve
+ */
+
+#ifndef EVENTPROC_PNWEIGHTTABLE_H_
+#define EVENTPROC_PNWEIGHTTABLE_H_
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <algorithm>
+#include <vector>
+
+namespace ldmx {
+
+    /**
+     * @class PnWeightTable
+     * @brief Tabulates the ratio of the fits to the inclusive W distribution
+     *
+     * @note
+     * The weight is the ratio of the fit to the lower slope of the W
+     * distribution,
+     *      low(W) = exp(a1 - a0*W),
+     * to the fit to its high tail,
+     *      high(W) = exp(b1 - b0*W)*(b2 + b3*W + ... + b8*W^6).
+     * Between the table bounds the weight is linearly interpolated from
+     * evenly spaced points.  The number of points is doubled until the
+     * relative deviation from the fits, checked at the quarter points of every
+     * interval, is below the requested tolerance.  Outside of the bounds the
+     * fits are evaluated directly.
+     */
+    class PnWeightTable {
+
+        public:
+
+            /** Parameters a0, a1 of the fit to the lower slope. */
+            static const std::vector<double> DEFAULT_LOW_FIT_PARAMETERS;
+
+            /** Parameters b0 to b8 of the fit to the high tail. */
+            static const std::vector<double> DEFAULT_HIGH_FIT_PARAMETERS;
+
+            /**
+             * Constructor.
+             *
+             * @param lowFitParameters The parameters a0, a1 of the lower slope fit.
+             * @param highFitParameters The parameters b0 to b8 of the high tail fit.
+             * @param wMin The lower bound of the table [MeV].
+             * @param wMax The upper bound of the table [MeV].
+             * @param tolerance The maximum relative deviation of the table from the fits.
+             */
+            PnWeightTable(const std::vector<double>& lowFitParameters = DEFAULT_LOW_FIT_PARAMETERS,
+                    const std::vector<double>& highFitParameters = DEFAULT_HIGH_FIT_PARAMETERS,
+                    double wMin = 1150, double wMax = 3700, double tolerance = 1e-5);
+
+            /**
+             * Get the weight from the table, or from the fits outside of it.
+             *
+             * @param w The W of the nucleon [MeV].
+             * @return The weight.
+             */
+            double evaluate(double w) const {
+                if (!(w >= wMin_ && w < wMax_)) return evaluateFits(w);
+                double x = (w - wMin_)*inverseStep_;
+                int index = std::min(int(x), int(weights_.size()) - 2);
+                double fraction = x - index;
+                return weights_[index] + fraction*(weights_[index + 1] - weights_[index]);
+            }
+
+            /**
+             * Get the weight from the fits.
+             *
+             * @param w The W of the nucleon [MeV].
+             * @return The weight.
+             */
+            double evaluateFits(double w) const;
+
+            /** @return The number of intervals in the table. */
+            int getIntervals() const { return weights_.size() - 1; }
+
+            /** @return The largest relative deviation from the fits found when building the table. */
+            double getMaxDeviation() const { return maxDeviation_; }
+
+        private:
+
+            /** Parameters of the fit to the lower slope. */
+            std::vector<double> lowFit_;
+
+            /** Parameters of the fit to the high tail. */
+            std::vector<double> highFit_;
+
+            /** Lower bound of the table [MeV]. */
+            double wMin_;
+
+            /** Upper bound of the table [MeV]. */
+            double wMax_;
+
+            /** Number of intervals per MeV. */
+            double inverseStep_{0};
+
+            /** Weights at the interval edges. */
+            std::vector<double> weights_;
+
+            /** Largest relative deviation from the fits found when building the table. */
+            double maxDeviation_{0};
+    };
+}
+
+#endif // EVENTPROC_PNWEIGHTTABLE_H_
@@ -43,6 +43,14 @@ namespace ldmx {
              */
             void produce(Event &event); 
 
+        private:
+
+            /** 
+             * Use the ECal hit flags of the sim particles when the simulation
+             * filled them, instead of scanning the ECal hit contributions.
+             */
+            bool useParticleFlags_{true};
+
     }; // RecoilMissesEcalSkimmer
 }
 
@@ -9,6 +9,7 @@
 
 // STL
 #include <string>
+#include <vector>
 
 // LDMX
 #include "Event/EventConstants.h"
@@ -50,10 +51,25 @@ namespace ldmx {
             virtual void produce(Event& event);
 
         private:
+
+            /**
+             * @struct SortKey
+             * @brief Energy deposition of a hit and its index in the input collection
+             */
+            struct SortKey {
+                float edep;
+                int index;
+            };
             
             TClonesArray *sortedHits;
             std::string collectionName;
             std::string outputCollection;
+
+            /** Number of hardest hits to keep, or all hits if not positive. */
+            int maxHits_{0};
+
+            /** Sort keys of the current event, reused across events. */
+            std::vector<SortKey> keys_;
     };
 
 }
@@ -12,6 +12,7 @@
 //   C++ StdLib   //
 //----------------//
 #include <time.h>
+#include <vector>
 
 //----------//
 //   ROOT   //
@@ -53,8 +54,21 @@ namespace ldmx {
              */
             void produce(Event &event); 
 
+            /** Print the number of dropped hits per layer, if enabled. */
+            void onProcessEnd();
+
         private: 
 
+            /**
+             * Get the efficiency of a layer.
+             *
+             * @param layer The layer ID of the hit.
+             * @return The probability to keep a hit on the layer.
+             */
+            double getEfficiency(int layer) const {
+                return (layer >= 0 && layer < (int) layerEff_.size()) ? layerEff_[layer] : hitEff_;
+            }
+
             /** 
              * Random number generator used to determine if hit should be
              * dropped. 
@@ -64,10 +78,23 @@ namespace ldmx {
             /** Collection of digitized tracker strip hits. */
             TClonesArray* siStripHits_{nullptr};
 
-            /** 
-             * Hit efficiency. For now, this is an integer in the range 0-100.
-             */
-            int hitEff_{99};
+            /** Hit efficiency of layers without a specific value, in the range 0-1. */
+            double hitEff_{0.99};
+
+            /** Hit efficiency indexed by layer ID, in the range 0-1. */
+            std::vector<double> layerEff_;
+
+            /** Uniform random numbers of the hits of the current event. */
+            std::vector<double> uniforms_;
+
+            /** Flag indicating if the drop counts are printed at the end of the job. */
+            bool printSummary_{false};
+
+            /** Number of sim hits seen, indexed by layer ID. */
+            std::vector<long> totalHits_;
+
+            /** Number of sim hits dropped, indexed by layer ID. */
+            std::vector<long> droppedHits_;
 
     }; // TrackerHitKiller
 }
@@ -7,6 +7,10 @@
 #ifndef EVENTPROC_TRIGGERPROCESSOR_H_
 #define EVENTPROC_TRIGGERPROCESSOR_H_
 
+// STL
+#include <cstdint>
+#include <vector>
+
 // LDMX
 #include "Event/TriggerResult.h"
 #include "Framework/EventProcessor.h"
@@ -23,6 +27,11 @@ namespace ldmx {
      * algorithms are then run on the event (ECAL layer sum). A trigger decision is
      * executed and the decision along with the algorithm name and relevant variables
      * are stored in a TriggerResult object which is added to the collection.
+     *
+     * In the center tower mode, the energy is only summed over the cells whose
+     * center lies within a radius of the ECal center.  Several radii can be
+     * given; their sums are all computed in the same loop over the hits and
+     * stored as algorithm variables, while the decision is made on the first.
      */
     class TriggerProcessor : public Producer {
 
@@ -58,14 +67,33 @@ namespace ldmx {
              */
             virtual void produce(Event& event);
 
+            /** The largest number of tower radii evaluated at once. */
+            static const int MAX_TOWER_RADII = 32;
+
         private:
 
+            /**
+             * Build the tower masks from the cell centers of the hexagonal
+             * readout.
+             */
+            void buildTowerMasks();
+
+            /**
+             * Get the dense index of an ECal cell, running over the cells
+             * of all modules of a layer.
+             * @param id The raw ECal detector ID.
+             * @return The dense cell index.
+             */
+            unsigned denseCellIndex(int id) const {
+                return ((id >> 12) & 0x7)*cellsPerModule_ + (id >> 15);
+            }
+
             /** The energy sum to make cut on. */
             float layerESumCut_{0};
 
             /** The trigger mode to run in. Mode zero sums over
              * all cells in layer, while in mode 1 only cells in
-             * center module are summed over. (TODO)
+             * the center tower are summed over.
              */
             int mode_{0};
 
@@ -75,6 +103,18 @@ namespace ldmx {
             /** The last layer of layer sum. */
             int endLayer_{0};
 
+            /** The radii of the center towers [mm]. */
+            std::vector<double> towerRadii_;
+
+            /** The number of cells in an ECal module. */
+            unsigned cellsPerModule_{0};
+
+            /**
+             * The tower membership of each cell, indexed by dense cell
+             * index.  Bit i is set if the cell is within the tower radius i.
+             */
+            std::vector<uint32_t> towerMasks_;
+
             /** The name of the trigger algorithm used. */
             TString algoName_;
 
@@ -15,3 +15,22 @@ ecalDigis.parameters["padCapacitance"] = 27.56
 
 # set the readout threshold in multiples of RMS noise
 ecalDigis.parameters["readoutThreshold"] = 4.
+
+# Energy calibration, E_cal = ((E/MIP)*w + E)*c + offset, tabulated per layer.
+# Layers past the end of layerWeights use its last weight.
+ecalDigis.parameters["layerWeights"] = [1.641, 3.526, 5.184, 6.841,
+        8.222, 8.775, 8.775, 8.775, 8.775, 8.775, 8.775, 8.775, 8.775, 8.775,
+        8.775, 8.775, 8.775, 8.775, 8.775, 8.775, 8.775, 8.775, 12.642, 16.51,
+        16.51, 16.51, 16.51, 16.51, 16.51, 16.51, 16.51, 16.51, 16.51, 8.45]
+ecalDigis.parameters["secondOrderEnergyCorrection"] = 0.948
+# Optional energy offsets (MeV) indexed by layer, zero when not given
+#ecalDigis.parameters["layerGainOffsets"] = [0.0]*34
+
+# Also add the digis as an EcalDigiCollection named ecalDigisCompact, which
+# stores sorted, delta encoded IDs and fixed-point values.  The full
+# collection can then be dropped from the output with "drop ecalDigis_".
+ecalDigis.parameters["compactOutput"] = 0
+
+# Precision of the compact amplitudes and energies (MeV) and times (ns)
+ecalDigis.parameters["energyPrecision"] = 0.001
+ecalDigis.parameters["timePrecision"] = 0.01
@@ -17,3 +17,7 @@ hcalDigis.parameters["mev_per_mip"] = 1.4*20./6.
 hcalDigis.parameters["pe_per_mip"] = 68. # PEs per MIP at 1m (assume 80% attentuation of 1m)
 hcalDigis.parameters["strip_attenuation_length"] = 5. # this is in m
 hcalDigis.parameters["strip_position_resolution"] = 150. # this is in mm
+
+# Also add the digis as HitColumns named hcalDigiColumns, with one array per
+# hit member.  The HCal veto can read them by setting its hits_collection.
+hcalDigis.parameters["columnsOutput"] = 0
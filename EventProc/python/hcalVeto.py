@@ -6,3 +6,6 @@ hcalVeto.parameters['pe_threshold'] = 5.0
 hcalVeto.parameters['max_time'] = 50.0
 hcalVeto.parameters['max_depth'] = 4000.0
 hcalVeto.parameters['back_min_pe'] = 1.
+# Hits read by the veto, either hcalDigis or hcalDigiColumns when the digis
+# are also written as columns
+hcalVeto.parameters['hits_collection'] = "hcalDigis"
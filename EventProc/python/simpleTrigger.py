@@ -10,3 +10,7 @@ simpleTrigger.parameters["threshold"] = 1500.0
 simpleTrigger.parameters["mode"] = 0
 simpleTrigger.parameters["start_layer"] = 1
 simpleTrigger.parameters["end_layer"] = 20
+
+# center tower mode (mode 1): the radii of the towers around the ECal center
+# in mm, all summed in the same pass; the decision is made on the first one
+simpleTrigger.parameters["tower_radii"] = [85.0]
@@ -7,6 +7,8 @@ from LDMX.Framework import ldmxcfg
 ecalSimHitSort = ldmxcfg.Producer("ecalSimHitSort", "ldmx::SimHitSortProcessor")
 ecalSimHitSort.parameters["simHitCollection"]="EcalSimHits"
 ecalSimHitSort.parameters["outputCollection"]="SortedEcalSimHits"
+# Keep only the given number of hardest hits, or all hits if 0
+ecalSimHitSort.parameters["maxHits"]=0
 hcalSimHitSort = ldmxcfg.Producer("hcalSimHitSort", "ldmx::SimHitSortProcessor")
 hcalSimHitSort.parameters["simHitCollection"]="HcalSimHits"
 hcalSimHitSort.parameters["outputCollection"]="SortedHcalSimHits"
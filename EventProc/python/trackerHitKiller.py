@@ -6,3 +6,10 @@ trackerHitKiller = ldmxcfg.Producer("trackerHitKiller", "ldmx::TrackerHitKiller"
 
 # Configure
 trackerHitKiller.parameters['hitEfficiency'] = 99.0
+
+# Efficiency (%) of each layer, starting with layer 1.  Layers without an
+# entry use hitEfficiency.
+#trackerHitKiller.parameters['layerEfficiencies'] = [99.0]*10
+
+# Print the number of dropped hits per layer at the end of the job
+trackerHitKiller.parameters['printSummary'] = 0
@@ -7,6 +7,12 @@
 
 #include "EventProc/EcalDigiProducer.h"
 
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <algorithm>
+#include <cmath>
+
 namespace ldmx {
 
     const std::vector<double> LAYER_WEIGHTS 
@@ -49,50 +55,69 @@ namespace ldmx {
         noiseGenerator_->setNoiseThreshold(ps.getDouble("readoutThreshold")*noiseRMS_); 
 
         ecalDigis_ = new TClonesArray(EventConstants::ECAL_HIT.c_str(), 10000);
+
+        compactOutput_ = ps.getInteger("compactOutput", 0);
+        compactDigis_.setEnergyPrecision(ps.getDouble("energyPrecision", 0.001));
+        compactDigis_.setTimePrecision(ps.getDouble("timePrecision", 0.01));
+
+        // The calibrated energy ((E/MIP)*w + E)*c is affine in E, so the gain of
+        // every value of the 8 bit layer field is computed once.
+        std::vector<double> layerWeights = ps.getVDouble("layerWeights", LAYER_WEIGHTS);
+        std::vector<double> gainOffsets = ps.getVDouble("layerGainOffsets", std::vector<double>());
+        double correction = ps.getDouble("secondOrderEnergyCorrection", 0.948);
+        for (int layer = 0; layer < MAX_LAYER_FIELD; ++layer) {
+            double weight = layerWeights.empty() ? 0 : layerWeights[std::min<std::size_t>(layer, layerWeights.size() - 1)];
+            gainSlope_[layer] = (weight/MIP_SI_RESPONSE + 1)*correction;
+            gainOffset_[layer] = (layer < (int) gainOffsets.size()) ? gainOffsets[layer] : 0;
+        }
+
+        // Pack the ID of every channel once so noise hits only need a lookup.
+        channelIDs_.resize(TOTAL_CELLS);
+        for (int layer = 0; layer < NUM_ECAL_LAYERS; ++layer) {
+            for (int module = 0; module < HEX_MODULES_PER_LAYER; ++module) {
+                for (int cell = 0; cell < CELLS_PER_HEX_MODULE; ++cell) {
+                    detID_.setFieldValue(1, layer);
+                    detID_.setFieldValue(2, module);
+                    detID_.setFieldValue(3, cell);
+                    channelIDs_[(layer*HEX_MODULES_PER_LAYER + module)*CELLS_PER_HEX_MODULE + cell] = detID_.pack();
+                }
+            }
+        }
+
+        // The bits past the last channel are marked as occupied for good.
+        int nWords = (TOTAL_CELLS + 63)/64;
+        occupied_.assign(nWords, 0);
+        if (TOTAL_CELLS % 64) {
+            occupied_.back() = ~uint64_t(0) << (TOTAL_CELLS % 64);
+        }
+        chosen_.assign(nWords, 0);
+        freeBefore_.resize(nWords + 1);
     }
 
     void EcalDigiProducer::produce(Event& event) {
 
-        TClonesArray* ecalSimHits = (TClonesArray*) event.getCollection(EventConstants::ECAL_SIM_HITS);
-        int numEcalSimHits = ecalSimHits->GetEntries();
+        const TClonesArray* ecalSimHits = event.getCollection(EventConstants::ECAL_SIM_HITS);
+        int numEcalSimHits = ecalSimHits->GetEntriesFast();
 
         //std::cout << "[ EcalDigiProducer ] : Got " << numEcalSimHits 
         //          << " ECal hits in event " << event.getEventHeader()->getEventNumber()
         //          << std::endl;
 
-        //First we simulate noise injection into each hit and store layer-wise 
-        // max cell ids
-        for (int iHit = 0; iHit < numEcalSimHits; iHit++) {
-            
-            SimCalorimeterHit* simHit = (SimCalorimeterHit*) ecalSimHits->At(iHit);
-
-            double hitNoise = noiseInjector_->Gaus(0, noiseRMS_);
-            layer_cell_pair hit_pair = hitToPair(simHit);
-
-            EcalHit* digiHit = (EcalHit*) (ecalDigis_->ConstructedAt(iHit));
-
-            digiHit->setID(simHit->getID());
-            double energy = simHit->getEdep() + hitNoise;
-            digiHit->setAmplitude(energy);
-            if (energy > readoutThreshold_) {
-                digiHit->setEnergy(((energy/MIP_SI_RESPONSE)*LAYER_WEIGHTS[hit_pair.first]+energy)*0.948);
-                digiHit->setTime(simHit->getTime());
-            } else {
-                digiHit->setEnergy(0);
-                digiHit->setTime(-1000);
-            }
-        }
+        digitizeSimHits(ecalSimHits);
 
         // Given the number of channels without a hit, calculate the expected 
         // number of noise hits above the readout threshold and randomly 
-        // assign them to Ecal cells
-        int emptyChannels = TOTAL_CELLS - numEcalSimHits;
+        // assign them to distinct empty Ecal cells
+        int emptyChannels = TOTAL_CELLS - occupiedChannels_.size();
         //std::cout << "[ EcalDigiProducer ]: Total number of empty channels: " << emptyChannels << std::endl;
         std::vector<double> noiseHits = noiseGenerator_->generateNoiseHits(emptyChannels);
         //std::cout << "[ EcalDigiProducer ]: Total number of noise hits: " << noiseHits.size() << std::endl; 
+        placeNoiseHits(std::min<int>(noiseHits.size(), emptyChannels));
+
         int iHit = numEcalSimHits; 
-        for (double noiseHit : noiseHits) { 
-            //std::cout << "[ EcalDigiProducer ]: Noise hit amplitude: " << noiseHit << std::endl;
+        for (std::size_t iNoise = 0; iNoise < noiseChannels_.size(); ++iNoise) {
+            double noiseHit = noiseHits[iNoise];
+            int channel = noiseChannels_[iNoise];
 
             // Construct a hit in the ith position
             EcalHit* digiHit = (EcalHit*) (ecalDigis_->ConstructedAt(iHit));
@@ -100,20 +125,12 @@ namespace ldmx {
             // Set the raw energy of the hit
             digiHit->setAmplitude(noiseHit);
 
-            // Generate a random ID and pack it
-            int layerID = noiseInjector_->Integer(NUM_ECAL_LAYERS); 
-            //std::cout << "[ EcalDigiProducer ]: Random layer ID: " << layerID << std::endl;
-            int moduleID = noiseInjector_->Integer(HEX_MODULES_PER_LAYER); 
-            //std::cout << "[ EcalDigiProducer ]: Random module ID: " << moduleID << std::endl;
-            int cellID = noiseInjector_->Integer(CELLS_PER_HEX_MODULE); 
-            //std::cout << "[ EcalDigiProducer ]: Random cell ID: " << cellID << std::endl;
-            detID_.setFieldValue(1, layerID); 
-            detID_.setFieldValue(2, moduleID); 
-            detID_.setFieldValue(3, cellID); 
-            digiHit->setID(detID_.pack()); 
+            // Take the ID of the empty channel from the table
+            digiHit->setID(channelIDs_[channel]);
 
             // Set the calibrated energy of the hit
-            digiHit->setEnergy(((noiseHit/MIP_SI_RESPONSE)*LAYER_WEIGHTS[layerID]+noiseHit)*0.948);
+            int layerID = channel/(HEX_MODULES_PER_LAYER*CELLS_PER_HEX_MODULE);
+            digiHit->setEnergy(gainSlope_[layerID]*noiseHit + gainOffset_[layerID]);
             
             // Identify this hit as a noise hit.
             digiHit->setNoiseHit(true);
@@ -121,6 +138,117 @@ namespace ldmx {
         } 
 
         event.add("ecalDigis", ecalDigis_);
+
+        if (compactOutput_) {
+            compactDigis_.pack(ecalDigis_);
+            event.add("ecalDigisCompact", &compactDigis_);
+        }
+    }
+
+    void EcalDigiProducer::digitizeSimHits(const TClonesArray* simHits) {
+
+        // Release the channels of the previous event, resetting only the bits
+        // that were set.
+        for (int channel : occupiedChannels_) {
+            occupied_[channel >> 6] &= ~(uint64_t(1) << (channel & 63));
+        }
+        occupiedChannels_.clear();
+
+        int nHits = simHits->GetEntriesFast();
+        fillNoiseBuffer(nHits);
+
+        const float threshold = readoutThreshold_;
+        for (int iHit = 0; iHit < nHits; ++iHit) {
+
+            SimCalorimeterHit* simHit = static_cast<SimCalorimeterHit*>(simHits->At(iHit));
+            int id = simHit->getID();
+            int layer = (id >> 4) & 0xFF;
+
+            EcalHit* digiHit = static_cast<EcalHit*>(ecalDigis_->ConstructedAt(iHit));
+            digiHit->setID(id);
+            float energy = simHit->getEdep() + noiseBuffer_[iHit];
+            digiHit->setAmplitude(energy);
+            if (energy > threshold) {
+                digiHit->setEnergy(gainSlope_[layer]*energy + gainOffset_[layer]);
+                digiHit->setTime(simHit->getTime());
+            } else {
+                digiHit->setEnergy(0);
+                digiHit->setTime(-1000);
+            }
+
+            // Mark the channel so no noise hit is placed on it.
+            int channel = getChannel(id);
+            if (channel >= 0 && !(occupied_[channel >> 6] & (uint64_t(1) << (channel & 63)))) {
+                occupied_[channel >> 6] |= uint64_t(1) << (channel & 63);
+                occupiedChannels_.push_back(channel);
+            }
+        }
+    }
+
+    void EcalDigiProducer::fillNoiseBuffer(int nHits) {
+
+        // Box-Muller turns each pair of uniforms into two Gaussian values.
+        int nPairs = (nHits + 1)/2;
+        uniformBuffer_.resize(2*nPairs);
+        noiseBuffer_.resize(2*nPairs);
+        noiseInjector_->RndmArray(2*nPairs, uniformBuffer_.data());
+
+        const double rms = noiseRMS_;
+        for (int iPair = 0; iPair < nPairs; ++iPair) {
+            double radius = rms*std::sqrt(-2*std::log(uniformBuffer_[2*iPair]));
+            double phi = 2*M_PI*uniformBuffer_[2*iPair + 1];
+            noiseBuffer_[2*iPair] = radius*std::cos(phi);
+            noiseBuffer_[2*iPair + 1] = radius*std::sin(phi);
+        }
+    }
+
+    int EcalDigiProducer::getChannel(int id) const {
+        int layer = (id >> 4) & 0xFF;
+        int module = (id >> 12) & 0x7;
+        int cell = (unsigned(id) >> 15);
+        if (layer >= NUM_ECAL_LAYERS || module >= HEX_MODULES_PER_LAYER || cell >= CELLS_PER_HEX_MODULE) {
+            return -1;
+        }
+        return (layer*HEX_MODULES_PER_LAYER + module)*CELLS_PER_HEX_MODULE + cell;
+    }
+
+    void EcalDigiProducer::placeNoiseHits(int nNoise) {
+
+        noiseChannels_.clear();
+        if (nNoise <= 0) {
+            return;
+        }
+
+        // Count the free channels before each word so a rank among the free
+        // channels can be turned into a channel.
+        int nWords = occupied_.size();
+        freeBefore_[0] = 0;
+        for (int iWord = 0; iWord < nWords; ++iWord) {
+            freeBefore_[iWord + 1] = freeBefore_[iWord] + 64 - __builtin_popcountll(occupied_[iWord]);
+        }
+        int nFree = freeBefore_[nWords];
+
+        // Floyd's algorithm picks nNoise distinct ranks with one draw each.
+        for (int j = nFree - nNoise; j < nFree; ++j) {
+            int rank = noiseInjector_->Integer(j + 1);
+            if (chosen_[rank >> 6] & (uint64_t(1) << (rank & 63))) {
+                rank = j;
+            }
+            chosen_[rank >> 6] |= uint64_t(1) << (rank & 63);
+            noiseChannels_.push_back(rank);
+        }
+
+        for (int& channel : noiseChannels_) {
+            int rank = channel;
+            chosen_[rank >> 6] &= ~(uint64_t(1) << (rank & 63));
+
+            int iWord = std::upper_bound(freeBefore_.begin(), freeBefore_.end(), rank) - freeBefore_.begin() - 1;
+            uint64_t free = ~occupied_[iWord];
+            for (int iSkip = rank - freeBefore_[iWord]; iSkip > 0; --iSkip) {
+                free &= free - 1;
+            }
+            channel = iWord*64 + __builtin_ctzll(free);
+        }
     }
 }
 
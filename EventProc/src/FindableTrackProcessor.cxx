@@ -7,6 +7,11 @@
 
 #include "EventProc/FindableTrackProcessor.h"
 
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <algorithm>
+
 namespace ldmx { 
 
     FindableTrackProcessor::FindableTrackProcessor(const std::string &name, Process &process) :
@@ -35,7 +40,7 @@ namespace ldmx {
 
         // Create the hit map
         //this->createHitMap(recoilSimHits); 
-        this->createHitMap(siStripHits); 
+        this->createHitMap(simParticles, siStripHits); 
         
         // Loop through all sim particles and check which are findable 
         int resultCount = 0;
@@ -48,7 +53,7 @@ namespace ldmx {
             if (abs(simParticle->getCharge()) != 1) continue;
     
             // Check if the track is findable 
-            if (hitMap_.count(simParticle) == 1) {
+            if (hitCount_[particleCount] > 0) {
                 
                 // Create a result instance
                 FindableTrackResult* findableTrackResult 
@@ -58,7 +63,7 @@ namespace ldmx {
                 findableTrackResult->setSimParticle(simParticle);
 
                 // Check if the track is findable
-                this->isFindable(findableTrackResult, hitMap_[simParticle]); 
+                isFindable(findableTrackResult, layerMask_[particleCount]); 
                 resultCount++;
             }      
         }
@@ -67,14 +72,24 @@ namespace ldmx {
         event.add("FindableTracks", findableTrackResults_);
     }
 
-    void FindableTrackProcessor::createHitMap(const TClonesArray* siStripHits) { 
+    void FindableTrackProcessor::createHitMap(const TClonesArray* simParticles, const TClonesArray* siStripHits) { 
        
-        // Clear the hit map to remove any previous relations 
-        hitMap_.clear();
+        // Reset the tables.  They keep their capacity, so nothing is 
+        // allocated once they have grown to the largest event.
+        int nParticles = simParticles->GetEntriesFast();
+        layerMask_.assign(nParticles, 0);
+        hitCount_.assign(nParticles, 0);
+
+        // Hits refer to their particle by address, so sort the addresses 
+        // once to look up the collection index of a hit's particle.
+        particleIndex_.clear();
+        for (int particleCount = 0; particleCount < nParticles; ++particleCount) {
+            particleIndex_.emplace_back(static_cast<const SimParticle*>(simParticles->At(particleCount)), particleCount);
+        }
+        std::sort(particleIndex_.begin(), particleIndex_.end());
 
         // Loop over all recoil tracker sim hits and check which layers, if any,
         // the sim particle deposited energy in.
-        std::vector<int> recoilHitCount(10, 0);
         for (int hitCount = 0; hitCount < siStripHits->GetEntriesFast(); ++hitCount) {
 
             // Get the SimTrackerHit from the collection of recoil sim hits.
@@ -86,85 +101,63 @@ namespace ldmx {
             // Get the SimTrackerHit associated with this strip hit
             SimTrackerHit* simTrackerHit = static_cast<SimTrackerHit*>(siStripHit->getSimTrackerHits()->At(0));  
 
-            // Get the MC particle associated with this hit
-            SimParticle* simParticle = simTrackerHit->getSimParticle();
-
-            // If the particle ins't in the hit map, add it.
-            if (hitMap_.count(simParticle) == 0) {
-                hitMap_[simParticle] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-            }
-            
-            // Increment the hit count for the layer
-            hitMap_[simParticle][simTrackerHit->getLayerID() - 1]++;
+            // Find the index of the MC particle associated with this hit
+            const SimParticle* simParticle = simTrackerHit->getSimParticle();
+            auto entry = std::lower_bound(particleIndex_.begin(), particleIndex_.end(), 
+                    std::make_pair(simParticle, 0));
+            if (entry == particleIndex_.end() || entry->first != simParticle) continue;
+
+            // Mark the layer as hit
+            int layer = simTrackerHit->getLayerID() - 1;
+            if (layer < 0 || layer >= RECOIL_LAYERS) continue;
+            layerMask_[entry->second] |= 1u << layer;
+            hitCount_[entry->second]++;
         }
     }
 
-    void FindableTrackProcessor::isFindable(FindableTrackResult* result, std::vector<int> hitCount) { 
+    void FindableTrackProcessor::isFindable(FindableTrackResult* result, unsigned layerMask) { 
        
-        /*std::cout << "[ FindableTrackProcessor ]: Hit Vec [ ";
-        for (auto index : hitCount) { 
-            std::cout << index << ", ";
-        }
-        std::cout << " ]" << std::endl;*/
-
-        // Count how many 3D stereo hits are created by this particle
-        std::vector<int> hit3dVec{0, 0, 0, 0};
-        int hit3dCount{0};
-        for (int layerN = 0; layerN  < 8; layerN += 2) { 
-            if (hitCount[layerN]*hitCount[layerN+1] != 0) {
-                hit3dCount++;
-                hit3dVec[layerN/2]++; 
-            }
-        }
-        /*std::cout << "[ FindableTrackProcessor ]: " 
-                  << "Total 3D Hits: " << hit3dCount << std::endl;*/
-         
+        // A 3D stereo hit is created when both layers of a pair are hit, 
+        // which leaves the bit of the first layer of the pair set.
+        unsigned stereoHits = layerMask & (layerMask >> 1) & STEREO_PAIRS_MASK;
+        bool firstTwoStereo = (stereoHits & FIRST_TWO_STEREO_MASK) == FIRST_TWO_STEREO_MASK;
+        bool firstThreeStereo = (stereoHits & FIRST_THREE_STEREO_MASK) == FIRST_THREE_STEREO_MASK;
+        bool anyAxial = (layerMask & AXIAL_MASK) != 0;
+        bool bothAxial = (layerMask & AXIAL_MASK) == AXIAL_MASK;
 
         // A track is considered findable if 
         // 1) The first four stereo layers are hit
         // 2) Three of the first four layers are hit and an axial layer is hit
         // 3) Two of the first four layers are hit and both axial layers are hit
         bool trackFound{false};
-        if (hit3dCount == 4) { 
+        if (stereoHits == STEREO_PAIRS_MASK) { 
             result->setResult(FindableTrackResult::STRATEGY_4S, true); 
             trackFound = true;
-            /*std::cout << "[ FindableTrackProcessor ]: " 
-                      << "Can be found using 4S strategy." << std::endl;*/
         } 
         
-        if ((hit3dVec[0]*hit3dVec[1]*hit3dVec[2] > 0) && (hitCount[8] > 0 || hitCount[9] > 0)) {
+        if (firstThreeStereo && anyAxial) {
             result->setResult(FindableTrackResult::STRATEGY_3S1A, true); 
             trackFound = true;
-            /*std::cout << "[ findabletrackprocessor ]: " 
-                      << "can be found using 3s1a strategy." << std::endl;*/
         } 
         
-        if (hit3dVec[0]*hit3dVec[1] > 0 && (hitCount[8] > 0 && hitCount[9] > 0)) {
+        if (firstTwoStereo && bothAxial) {
             result->setResult(FindableTrackResult::STRATEGY_2S2A, true); 
             trackFound = true;
-            /*std::cout << "[ findabletrackprocessor ]: " 
-                      << "can be found using 2s2a strategy." << std::endl;*/
         } 
         
-        if (hitCount[8] > 0 && hitCount[9] > 0) { 
+        if (bothAxial) { 
             result->setResult(FindableTrackResult::STRATEGY_2A, true); 
             trackFound = true;
-            /*std::cout << "[ findabletrackprocessor ]: " 
-                      << "can be found using 2a strategy." << std::endl;*/
         }
 
-        if (hit3dVec[0]*hit3dVec[1] > 0) {
+        if (firstTwoStereo) {
             result->setResult(FindableTrackResult::STRATEGY_2S, true); 
             trackFound = true;
-            /*std::cout << "[ findabletrackprocessor ]: " 
-                      << "can be found using 2s strategy." << std::endl;*/
         } 
 
-        if (hit3dVec[0]*hit3dVec[1]*hit3dVec[2] > 0) {
+        if (firstThreeStereo) {
             result->setResult(FindableTrackResult::STRATEGY_3S, true); 
             trackFound = true;
-            /*std::cout << "[ findabletrackprocessor ]: " 
-                      << "can be found using 3s strategy." << std::endl;*/
         } 
 
         if (!trackFound) { 
@@ -173,4 +166,4 @@ namespace ldmx {
     }
 }
 
-DECLARE_PRODUCER_NS(ldmx, FindableTrackProcessor) 
+DECLARE_PRODUCER_NS(ldmx, FindableTrackProcessor)
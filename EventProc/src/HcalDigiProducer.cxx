@@ -32,6 +32,7 @@ namespace ldmx {
         pe_per_mip_                = ps.getDouble("pe_per_mip");
         strip_attenuation_length_  = ps.getDouble("strip_attenuation_length");
         strip_position_resolution_  = ps.getDouble("strip_position_resolution");
+        columnsOutput_             = ps.getInteger("columnsOutput", 0);
         noiseGenerator_ = new NoiseGenerator(meanNoise_,false);
         //noiseGenerator_->setNoiseThreshold(readoutThreshold_);
         noiseGenerator_->setNoiseThreshold(1); // hard-code this number, create noise hits for non-zero PEs! 
@@ -328,6 +329,13 @@ namespace ldmx {
         }
 
         event.add("hcalDigis", hits_);
+
+        // Also write the digis as contiguous arrays for column based consumers 
+        // such as the HCal veto.
+        if (columnsOutput_) {
+            digiColumns_.fill(hits_);
+            event.add("hcalDigiColumns", &digiColumns_);
+        }
     }
 
 }
@@ -6,6 +6,12 @@
 
 #include "EventProc/HcalVetoProcessor.h"
 
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <algorithm>
+#include <limits>
+
 //----------//
 //   ROOT   //
 //----------//
@@ -15,6 +21,7 @@
 //   ldmx-sw   //
 //-------------//
 #include "DetDescr/HcalID.h"
+#include "Event/HitColumns.h"
 
 namespace ldmx {
 
@@ -30,44 +37,48 @@ namespace ldmx {
         maxTime_ = pSet.getDouble("max_time"); 
         maxDepth_ = pSet.getDouble("max_depth"); 
         minPE_ = pSet.getDouble("back_min_pe");  
+        columnsName_ = pSet.getString("hits_collection", "hcalDigis");
     }
 
     void HcalVetoProcessor::produce(Event& event) {
 
-        // Get the collection of sim particles from the event 
-        const TClonesArray *hcalHits = event.getCollection("hcalDigis");
-       
-        // Loop over all of the Hcal hits and calculate to total photoelectrons
-        // in the event.
-        float totalPe{0};
+        // Get the Hcal hits as one contiguous array per member 
+        const HitColumns& hcalHits = event.getHitColumns(columnsName_);
+        const std::size_t nHits = hcalHits.size();
+        const int* id = hcalHits.getIDs().data();
+        const float* pes = hcalHits.getAmplitudes().data();
+        const float* minPEs = hcalHits.getMinAmplitudes().data();
+        const float* times = hcalHits.getTimes().data();
+        const float* zs = hcalHits.getZ().data();
+
+        // Mask the PE of the hits failing the cuts, without branches so the 
+        // loop can be vectorized:
+        //  - the hit time is outside the readout window, 
+        //  - the hit z position is beyond the maximum HCal depth, or
+        //  - one side of a back HCal bar is below threshold.  Double sided
+        //    readout is only being used for the back HCal bars.  For the
+        //    side HCal, just use the maximum PE as before.
+        const float masked = std::numeric_limits<float>::lowest();
+        const float maxTime = maxTime_, maxDepth = maxDepth_, minPE = minPE_;
+        maskedPE_.resize(nHits);
+        float* maskedPE = maskedPE_.data();
         float maxPE{-1000};
-        HcalHit* maxPEHit{nullptr}; 
-        for (size_t iHit{0}; iHit < hcalHits->GetEntriesFast(); ++iHit) { 
-            HcalHit* hcalHit = static_cast<HcalHit*>(hcalHits->At(iHit));
-
-            // If the hit time is outside the readout window, don't consider it.
-            if (hcalHit->getTime() >= maxTime_) continue;
-
-            // If the hit z position is beyond the maximum HCal depth, skip it.
-            if (hcalHit->getZ() > maxDepth_) continue;
-
-            // Get the total PE in the bar
-            float pe = hcalHit->getPE(); 
-
-            // Keep track of the total PE
-            totalPe += pe; 
-
-            // Check that both sides of the bar have a PE value above threshold.
-            // If not, don't consider the hit.  Double sided readout is only 
-            // being used for the back HCal bars.  For the side HCal, just 
-            // use the maximum PE as before.
-            if ( (hcalHit->getSection() == HcalSection::BACK) && (hcalHit->getMinPE() < minPE_) ) continue;
+        for (std::size_t iHit = 0; iHit < nHits; ++iHit) { 
+            bool isBack = ((id[iHit] & 0x7000) >> 12) == HcalSection::BACK;
+            bool keep = (times[iHit] < maxTime) & (zs[iHit] <= maxDepth) & !(isBack & (minPEs[iHit] < minPE));
+            float pe = pes[iHit];
+            maskedPE[iHit] = keep ? pe : masked;
+            maxPE = (maskedPE[iHit] > maxPE) ? maskedPE[iHit] : maxPE;
+        }
 
-            // Find the maximum PE in the list
-            if (maxPE < pe) {
-                maxPE = pe;
-                maxPEHit = hcalHit; 
-            }
+        // The hit with the maximum PE is the first one reaching it.  The
+        // columns keep the order of the digi collection, so the hit object
+        // is only looked up once.
+        HcalHit* maxPEHit{nullptr}; 
+        if (maxPE > -1000) {
+            std::size_t maxIndex = std::find(maskedPE, maskedPE + nHits, maxPE) - maskedPE;
+            const TClonesArray* hcalDigis = event.getCollection("hcalDigis");
+            maxPEHit = static_cast<HcalHit*>(hcalDigis->At(maxIndex));
         }
 
         // If the maximum PE found is below threshold, it passes the veto.
@@ -20,6 +20,11 @@
 
 #include "EventProc/PnWeightProcessor.h"
 
+//----------//
+//   LDMX   //
+//----------//
+#include "Tools/AnalysisUtils.h"
+
 namespace ldmx {
 
     const int PnWeightProcessor::PROTON_PDGID = 2212;
@@ -28,14 +33,6 @@ namespace ldmx {
 
     PnWeightProcessor::PnWeightProcessor(const std::string &name, Process &process) :
         Producer(name, process) {
-
-            lFit->SetParameters(0.01093, 2.766); 
-
-            std::string func = "exp([1]-[0]*x)*([2]+[3]*x + [4]*pow(x,2)"; 
-            func += " + [5]*pow(x,3) + [6]*pow(x,4) + [7]*pow(x,5) + [8]*pow(x,6))"; 
-            hFit = new TF1("hfit", func.c_str(), 1150, 3700);
-            hFit->SetParameters(0.004008, 11.23, 1.242e-6, -1.964e-9, 
-                    8.243e-13, 9.333e-17, -7.584e-20, -1.991e-23, 9.757e-27);
     }
 
     PnWeightProcessor::~PnWeightProcessor() { 
@@ -44,6 +41,13 @@ namespace ldmx {
     void PnWeightProcessor::configure(const ParameterSet& pSet) {
         wThreshold_ = pSet.getDouble("w_threshold");
         thetaThreshold_ = pSet.getDouble("theta_threshold");
+
+        // Tabulate the weight curve.  New fits only need new parameters.
+        weightTable_ = PnWeightTable(
+                pSet.getVDouble("low_fit_parameters", PnWeightTable::DEFAULT_LOW_FIT_PARAMETERS),
+                pSet.getVDouble("high_fit_parameters", PnWeightTable::DEFAULT_HIGH_FIT_PARAMETERS),
+                pSet.getDouble("table_w_min", 1150), pSet.getDouble("table_w_max", 3700),
+                pSet.getDouble("table_tolerance", 1e-5));
     }
 
     void PnWeightProcessor::produce(Event& event) {
@@ -56,41 +60,9 @@ namespace ldmx {
         const TClonesArray* simParticles = event.getCollection("SimParticles");
         if (simParticles->GetEntriesFast() == 0) return; 
 
-        // Loop through all of the particles and search for the recoil electron
-        // i.e. an electron which doesn't have any parents.
-        SimParticle* recoilElectron{nullptr};
-        for (int particleCount = 0; particleCount < simParticles->GetEntriesFast(); ++particleCount) { 
-            
-            // Get the nth particle from the collection of particles
-            SimParticle* simParticle = static_cast<SimParticle*>(simParticles->At(particleCount));
-
-            // If the particle doesn't correspond to the recoil electron, 
-            // continue to the next particle.
-            if ((simParticle->getPdgID() == 11) && (simParticle->getParentCount() == 0)) {
-                //std::cout << "[ pnWeightProcessor ]: Recoil electron found." << std::endl;
-                recoilElectron = simParticle; 
-                break;
-            }
-        }
-        /*std::cout << "[ PnWeightProcessor ]: Recoil electron total daughters: " 
-                  << recoilElectron->getDaughterCount() 
-                  << std::endl;*/
-
-        // Search for the PN gamma and use it to get the PN daughters.
-        SimParticle* pnGamma{nullptr};
-        for (int daughterCount = 0; daughterCount < recoilElectron->getDaughterCount(); ++daughterCount) {
-            SimParticle* daughter = recoilElectron->getDaughter(daughterCount);
-            /*std::cout << "[ PnWeightProcessor ]: Total daughters: "
-                      << daughter->getDaughterCount() 
-                      << std::endl;*/
-            if ((daughter->getDaughterCount() > 0) && 
-                    (daughter->getDaughter(0)->getProcessType() == SimParticle::ProcessType::photonNuclear)) {
-                /*std::cout << "[ PnWeightProcessor ]: Found PN gamma!"
-                          << std::endl;*/
-                pnGamma = daughter; 
-                break;
-            }
-        }
+        // Get the PN gamma from the per-event cache, which shares the 
+        // recoil electron and PN gamma searches with other processors.
+        const SimParticle* pnGamma = event.getDerived<Analysis::PNGamma>();
 
         // For PN biased events, there should always be a gamma that
         // underwent a PN reaction.
@@ -107,7 +79,7 @@ namespace ldmx {
         for (int pnDaughterCount = 0; pnDaughterCount < pnGamma->getDaughterCount(); ++pnDaughterCount) { 
            
             // Get a daughter of the PN gamma 
-            SimParticle* pnDaughter = pnGamma->getDaughter(pnDaughterCount);
+            const SimParticle* pnDaughter = pnGamma->getDaughter(pnDaughterCount);
 
             // Calculate the kinetic energy
             double ke = (pnDaughter->getEnergy() - pnDaughter->getMass());
@@ -172,10 +144,10 @@ namespace ldmx {
     }
 
     double PnWeightProcessor::calculateWeight(double w) {
-        return lFit->Eval(w)/hFit->Eval(w); 
+        return weightTable_.evaluate(w); 
     }
 
-    double PnWeightProcessor::calculateW(SimParticle* particle, double delta) {
+    double PnWeightProcessor::calculateW(const SimParticle* particle, double delta) {
         double px = particle->getMomentum()[0];
         double py = particle->getMomentum()[1];
         double pz = particle->getMomentum()[2];
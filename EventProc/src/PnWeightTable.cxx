@@ -0,0 +1,80 @@
+/**
+ * @file PnWeightTable.cxx
+ * @brief Class that tabulates the photonuclear W reweighting curve
+ */
+
+#include "EventProc/PnWeightTable.h"
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <cmath>
+#include <sstream>
+
+//----------//
+//   LDMX   //
+//----------//
+#include "Framework/Exception.h"
+
+namespace ldmx {
+
+    const std::vector<double> PnWeightTable::DEFAULT_LOW_FIT_PARAMETERS = {0.01093, 2.766};
+
+    const std::vector<double> PnWeightTable::DEFAULT_HIGH_FIT_PARAMETERS = {0.004008, 11.23,
+        1.242e-6, -1.964e-9, 8.243e-13, 9.333e-17, -7.584e-20, -1.991e-23, 9.757e-27};
+
+    /** Number of intervals of the first table that is tried. */
+    static const int MIN_INTERVALS = 64;
+
+    /** Largest number of intervals before giving up on the tolerance. */
+    static const int MAX_INTERVALS = 1 << 20;
+
+    PnWeightTable::PnWeightTable(const std::vector<double>& lowFitParameters,
+            const std::vector<double>& highFitParameters, double wMin, double wMax, double tolerance) :
+            lowFit_(lowFitParameters), highFit_(highFitParameters), wMin_(wMin), wMax_(wMax) {
+
+        if (lowFit_.size() != DEFAULT_LOW_FIT_PARAMETERS.size()
+                || highFit_.size() != DEFAULT_HIGH_FIT_PARAMETERS.size()) {
+            EXCEPTION_RAISE("PnWeightTable", "The lower slope fit needs 2 parameters and the high tail fit 9.");
+        }
+        if (!(wMax_ > wMin_) || !(tolerance > 0)) {
+            EXCEPTION_RAISE("PnWeightTable", "The table needs a positive range and tolerance.");
+        }
+
+        for (int intervals = MIN_INTERVALS; intervals <= MAX_INTERVALS; intervals *= 2) {
+
+            double step = (wMax_ - wMin_)/intervals;
+            weights_.resize(intervals + 1);
+            for (int index = 0; index <= intervals; ++index) {
+                weights_[index] = evaluateFits(wMin_ + index*step);
+            }
+            inverseStep_ = 1/step;
+
+            maxDeviation_ = 0;
+            for (int index = 0; index < intervals; ++index) {
+                for (int quarter = 1; quarter < 4; ++quarter) {
+                    double w = wMin_ + (index + 0.25*quarter)*step;
+                    double exact = evaluateFits(w);
+                    double deviation = std::fabs(evaluate(w) - exact)/std::fabs(exact);
+                    if (!(deviation <= maxDeviation_)) maxDeviation_ = deviation;
+                }
+            }
+            if (maxDeviation_ <= tolerance) return;
+        }
+
+        std::stringstream message;
+        message << "The W table deviates from the fits by " << maxDeviation_
+                << " with " << MAX_INTERVALS << " intervals, above the tolerance of " << tolerance << ".";
+        EXCEPTION_RAISE("PnWeightTable", message.str());
+    }
+
+    double PnWeightTable::evaluateFits(double w) const {
+        double low = std::exp(lowFit_[1] - lowFit_[0]*w);
+        double polynomial = 0;
+        for (int order = 8; order >= 2; --order) {
+            polynomial = polynomial*w + highFit_[order];
+        }
+        double high = std::exp(highFit_[1] - highFit_[0]*w)*polynomial;
+        return low/high;
+    }
+}
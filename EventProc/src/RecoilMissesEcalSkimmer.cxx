@@ -7,6 +7,17 @@
 
 #include "EventProc/RecoilMissesEcalSkimmer.h"
 
+//----------//
+//   LDMX   //
+//----------//
+#include "Event/EventHeader.h"
+#include "Tools/AnalysisUtils.h"
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <stdexcept>
+
 namespace ldmx { 
     
     RecoilMissesEcalSkimmer::RecoilMissesEcalSkimmer(const std::string &name, Process &process):
@@ -17,6 +28,7 @@ namespace ldmx {
     }
 
     void RecoilMissesEcalSkimmer::configure(const ParameterSet &pset) { 
+        useParticleFlags_ = pset.getInteger("useParticleFlags", 1);
     }
 
     void RecoilMissesEcalSkimmer::produce(Event &event) { 
@@ -25,48 +37,39 @@ namespace ldmx {
         const TClonesArray *simParticles = event.getCollection("SimParticles");
         if (simParticles->GetEntriesFast() == 0) return; 
 
-        // Loop through all of the particles and search for the recoil electron
-        // i.e. an electron which doesn't have any parents.
-        SimParticle* recoilElectron{nullptr};
-        for (int particleCount = 0; particleCount < simParticles->GetEntriesFast(); ++particleCount) { 
-            
-            // Get the nth particle from the collection of particles
-            SimParticle* simParticle = static_cast<SimParticle*>(simParticles->At(particleCount));
-
-            // If the particle doesn't correspond to the recoil electron, 
-            // continue to the next particle.
-            if ((simParticle->getPdgID() == 11) && (simParticle->getParentCount() == 0)) {
-                //std::cout << "[ pnWeightProcessor ]: Recoil electron found." << std::endl;
-                recoilElectron = simParticle; 
-                break;
-            }
+        // Get the recoil electron from the per-event cache, i.e. the first 
+        // electron with generator status 1.  If there is none, the event 
+        // can't have recoil electron hits and is kept.
+        const SimParticle* recoilElectron{nullptr};
+        try { 
+            recoilElectron = event.getDerived<Analysis::RecoilElectron>();
+        } catch (const std::out_of_range&) { 
+            setStorageHint(hint_shouldKeep); 
+            return; 
         }
 
-        // Get the collection of simulated Ecal hits from the event. 
-        const TClonesArray* ecalSimHits = event.getCollection(EventConstants::ECAL_SIM_HITS);
-       
-        // Loop through the Ecal hits and check if the recoil electron is 
-        // associated with any of them.  If there are any recoil electron hits
-        // in the Ecal, drop the event.
         bool hasRecoilElectronHits = false; 
-        for (int iHit = 0; iHit < ecalSimHits->GetEntriesFast(); ++iHit) { 
-            
-            SimCalorimeterHit* simHit = static_cast<SimCalorimeterHit*>(ecalSimHits->At(iHit));
+        if (useParticleFlags_ && event.getEventHeader()->getIntParameter(SimParticle::ECAL_PARTICLE_FLAGS, 0)) {
 
-            /*std::cout << "[ RecoilMissesEcalSkimmer ]: "  
-                      << "Number of hit contributions: "  
-                      << simHit->getNumberOfContribs() << std::endl;*/
+            // The simulation flagged every particle with ECal hit 
+            // contributions, so no hits need to be looked at.
+            hasRecoilElectronHits = recoilElectron->hasEcalHits();
 
-            for (int iContrib = 0; iContrib < simHit->getNumberOfContribs(); ++iContrib) {
-                SimCalorimeterHit::Contrib contrib = simHit->getContrib(iContrib);
+        } else {
 
-                if (contrib.particle == recoilElectron) { 
-                    /*std::cout << "[ RecoilMissesEcalSkimmer ]: " 
-                              << "Ecal hit associated with recoil electron." << std::endl; */
-                    
+            // Get the collection of simulated Ecal hits from the event. 
+            const TClonesArray* ecalSimHits = event.getCollection(EventConstants::ECAL_SIM_HITS);
+       
+            // Loop through the Ecal hits and check if the recoil electron is 
+            // associated with any of them, stopping at the first one.
+            int recoilTrackID = recoilElectron->getTrackID();
+            for (int iHit = 0; iHit < ecalSimHits->GetEntriesFast(); ++iHit) { 
+                const SimCalorimeterHit* simHit = static_cast<const SimCalorimeterHit*>(ecalSimHits->At(iHit));
+                if (simHit->hasContribFromTrack(recoilTrackID)) {
                     hasRecoilElectronHits = true;
-                } 
-            } 
+                    break;
+                }
+            }
         }
        
         // Tell the skimmer to keep or drop the event based on whether there
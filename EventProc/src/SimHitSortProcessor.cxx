@@ -2,6 +2,7 @@
 #include "TString.h"
 
 // STL
+#include <algorithm>
 #include <cmath>
 
 #include "Event/SimCalorimeterHit.h"
@@ -16,28 +17,35 @@ namespace ldmx {
         sortedHits = new TClonesArray(EventConstants::SIM_CALORIMETER_HIT.c_str(),10000);
         collectionName = pSet.getString("simHitCollection");
         outputCollection = pSet.getString("outputCollection");
+        maxHits_ = pSet.getInteger("maxHits", 0);
     }
 
     void SimHitSortProcessor::produce(Event& event) {
-        TClonesArray* ecalSimHits = (TClonesArray*) event.getCollection(collectionName);
+        const TClonesArray* simHits = event.getCollection(collectionName);
 
-        int numEcalSimHits = ecalSimHits->GetEntries();
-        std::vector<SimCalorimeterHit*> vecSimCaloHit;
-
-        for(int iHit = 0; iHit < numEcalSimHits; ++iHit){
-            vecSimCaloHit.push_back((SimCalorimeterHit*)ecalSimHits->At(iHit));
+        // Sort compact keys instead of following a pointer per comparison.
+        int numSimHits = simHits->GetEntriesFast();
+        keys_.resize(numSimHits);
+        for(int iHit = 0; iHit < numSimHits; ++iHit){
+            keys_[iHit] = {static_cast<SimCalorimeterHit*>(simHits->At(iHit))->getEdep(), iHit};
         }// end loop over sim hits
 
-        std::sort(vecSimCaloHit.begin(),vecSimCaloHit.end(),[](SimCalorimeterHit* a, SimCalorimeterHit* b) {
-                return a->getEdep() > b->getEdep();   
-            });
+        // Hardest hits first, and input order among equal energies.
+        auto harder = [](const SortKey& a, const SortKey& b) {
+            return a.edep > b.edep || (a.edep == b.edep && a.index < b.index);
+        };
+
+        // Only the hardest maxHits_ hits need to be put in order.
+        int numSorted = (maxHits_ > 0) ? std::min(maxHits_, numSimHits) : numSimHits;
+        if (numSorted < numSimHits) {
+            std::partial_sort(keys_.begin(), keys_.begin() + numSorted, keys_.end(), harder);
+        } else {
+            std::sort(keys_.begin(), keys_.end(), harder);
+        }
 
-        for(int iHit = 0 ; iHit < vecSimCaloHit.size() ; iHit++){
+        for(int iHit = 0 ; iHit < numSorted ; iHit++){
             SimCalorimeterHit* simHit = (SimCalorimeterHit*) (sortedHits->ConstructedAt(iHit));
-            simHit->setID( vecSimCaloHit[iHit]->getID() );
-            simHit->setEdep( vecSimCaloHit[iHit]->getEdep() );
-            simHit->setPosition( vecSimCaloHit[iHit]->getPosition()[0] , vecSimCaloHit[iHit]->getPosition()[0] , vecSimCaloHit[iHit]->getPosition()[0] );
-            simHit->setTime( vecSimCaloHit[iHit]->getTime() );
+            *simHit = *static_cast<SimCalorimeterHit*>(simHits->At(keys_[iHit].index));
         }
 
         event.add(outputCollection.c_str(),sortedHits);
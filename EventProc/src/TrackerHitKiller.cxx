@@ -7,6 +7,11 @@
 
 #include "EventProc/TrackerHitKiller.h"
 
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <iostream>
+
 namespace ldmx { 
 
     TrackerHitKiller::TrackerHitKiller(const std::string& name, Process& process) :
@@ -18,10 +23,17 @@ namespace ldmx {
 
     void TrackerHitKiller::configure(const ParameterSet &pSet) { 
        
-        // Get the hit efficiency. For now, this will be an integer quantiy 
-        // in the range 0-100.  If more precision is needed in the future, 
-        // this can be updated.
-        hitEff_ = int(pSet.getDouble("hitEfficiency"));
+        // Get the hit efficiency in percent, used for all layers without
+        // their own value in layerEfficiencies.  The first entry of
+        // layerEfficiencies is the efficiency of layer 1.
+        hitEff_ = pSet.getDouble("hitEfficiency", 99.)/100.;
+        std::vector<double> layerEff = pSet.getVDouble("layerEfficiencies", std::vector<double>());
+        layerEff_.assign(layerEff.size() + 1, hitEff_);
+        for (std::size_t iLayer = 0; iLayer < layerEff.size(); ++iLayer) {
+            layerEff_[iLayer + 1] = layerEff[iLayer]/100.;
+        }
+
+        printSummary_ = pSet.getInteger("printSummary", 0);
 
         // Instantiate the collection of Si strip hits 
         siStripHits_ = new TClonesArray("ldmx::SiStripHit", 10000); 
@@ -31,17 +43,32 @@ namespace ldmx {
        
         // Get the collection of Recoil sim hits from the event 
         const TClonesArray* recoilSimHits = event.getCollection("RecoilSimHits");
+        int nSimHits = recoilSimHits->GetEntriesFast();
 
+        // Draw the random numbers of all hits at once.
+        uniforms_.resize(nSimHits);
+        if (nSimHits > 0) random_->RndmArray(nSimHits, uniforms_.data());
+
+        // Keep the surviving hits in order at the front of the collection.
         int iHit = 0;
-        for (int hitCount = 0; hitCount < recoilSimHits->GetEntriesFast(); ++hitCount) { 
+        for (int hitCount = 0; hitCount < nSimHits; ++hitCount) { 
             
-            if (random_->Integer(100) >= hitEff_) { 
-                std::cout << "[ TrackerHitKiller ]: Dropping hit." << std::endl;
-                continue;
-            } else {
-                // Get the SimTrackerHit from the collection of recoil sim hits.
+            SimTrackerHit* simHit = static_cast<SimTrackerHit*>(recoilSimHits->At(hitCount));
+            int layer = simHit->getLayerID();
+            bool keep = uniforms_[hitCount] < getEfficiency(layer);
+
+            if (printSummary_ && layer >= 0) {
+                if (layer >= (int) totalHits_.size()) {
+                    totalHits_.resize(layer + 1, 0);
+                    droppedHits_.resize(layer + 1, 0);
+                }
+                ++totalHits_[layer];
+                if (!keep) ++droppedHits_[layer];
+            }
+
+            if (keep) {
                 SiStripHit* stripHit = static_cast<SiStripHit*>(siStripHits_->ConstructedAt(iHit));
-               stripHit->addSimTrackerHit(static_cast<SimTrackerHit*>(recoilSimHits->At(hitCount))); 
+                stripHit->addSimTrackerHit(simHit); 
                 ++iHit;
             }
         }
@@ -49,6 +76,17 @@ namespace ldmx {
         //Add the result to the collection
         event.add("SiStripHits", siStripHits_);
     }
+
+    void TrackerHitKiller::onProcessEnd() {
+        if (!printSummary_) return;
+
+        std::cout << "[ TrackerHitKiller ]: Dropped hits per layer" << std::endl;
+        for (std::size_t layer = 0; layer < totalHits_.size(); ++layer) {
+            if (totalHits_[layer] == 0) continue;
+            std::cout << "  Layer " << layer << ": " << droppedHits_[layer] << " / " << totalHits_[layer]
+                      << " (efficiency " << getEfficiency(layer)*100 << "%)" << std::endl;
+        }
+    }
 }
 
 DECLARE_PRODUCER_NS(ldmx, TrackerHitKiller) 
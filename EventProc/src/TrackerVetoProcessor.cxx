@@ -6,11 +6,15 @@
 
 #include "EventProc/TrackerVetoProcessor.h"
 
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <cmath>
+
 //----------//
 //   ROOT   //
 //----------//
 #include "TClonesArray.h"
-#include "TVector3.h"
 
 //----------//
 //   LDMX   //
@@ -35,57 +39,47 @@ namespace ldmx {
 
     void TrackerVetoProcessor::produce(Event& event) {
 
-        // Get the collection of simulated particles from the event
-        const TClonesArray* particles = event.getCollection("SimParticles");
-      
-        // Search for the recoil electron 
-        const SimParticle* recoil = Analysis::searchForRecoil(particles); 
+        // Search for the recoil electron.  The scoring plane hits and the
+        // findable tracks are matched to it through its track ID, without
+        // resolving their particle references.
+        const SimParticle* recoil = event.getDerived<Analysis::RecoilElectron>(); 
+        int recoilTrackID = recoil->getTrackID();
 
         // Find the target scoring plane hit associated with the recoil
-        // electron and extract the momentum
-        double p{-1}, pt{-1}, px{-9999}, py{-9999}, pz{-9999}; 
-        SimTrackerHit* spHit{nullptr}; 
+        // electron, downstream of the target, and extract the momentum
+        double p{-1}; 
         if (event.exists("TargetScoringPlaneHits")) { 
             
-            // Get the collection of simulated particles from the event
+            // Get the collection of scoring plane hits from the event
             const TClonesArray* spHits = event.getCollection("TargetScoringPlaneHits");
             
-            //
-            for (size_t iHit{0}; iHit < spHits->GetEntriesFast(); ++iHit) { 
-                SimTrackerHit* hit = static_cast<SimTrackerHit*>(spHits->At(iHit)); 
-                if ((hit->getSimParticle() == recoil) && (hit->getLayerID() == 2)
-                        && (hit->getMomentum()[2] > 0)) {
-                    spHit = hit;
+            for (int iHit{0}; iHit < spHits->GetEntriesFast(); ++iHit) { 
+                const SimTrackerHit* hit = static_cast<const SimTrackerHit*>(spHits->At(iHit)); 
+                if ((hit->getSimParticleTrackID() == recoilTrackID) && (hit->getLayerID() == 2)
+                        && (hit->getPz() > 0)) {
+                    double px = hit->getPx(), py = hit->getPy(), pz = hit->getPz();
+                    p = std::sqrt(px*px + py*py + pz*pz); 
                     break; 
                 }
             }
-
-            if (spHit != nullptr) {
-                TVector3 recoilP(spHit->getMomentum().data()); 
-        
-                p = recoilP.Mag(); 
-                pt = recoilP.Pt(); 
-                px = recoilP.Px();
-                py = recoilP.Py(); 
-                pz = recoilP.Pz();  
-            }
         }
 
+        // Count the findable tracks and check if the recoil is one of them
         bool recoilIsFindable{false};
-        TrackMaps map;  
+        size_t findableCount{0};  
         if (event.exists("FindableTracks")) { 
-            // Get the collection of simulated particles from the event
-            const TClonesArray* tracks 
-                = event.getCollection("FindableTracks");
-
-            map = Analysis::getFindableTrackMaps(tracks);
-            
-            auto it = map.findable.find(recoil);
-            if ( it != map.findable.end()) recoilIsFindable = true; 
+            const TClonesArray* tracks = event.getCollection("FindableTracks");
+            for (int iTrack{0}; iTrack < tracks->GetEntriesFast(); ++iTrack) { 
+                FindableTrackResult* track = static_cast<FindableTrackResult*>(tracks->At(iTrack)); 
+                if (track->is4sFindable() || track->is3s1aFindable() || track->is2s2aFindable()) { 
+                    ++findableCount;
+                    if (track->getSimParticleTrackID() == recoilTrackID) recoilIsFindable = true;
+                }
+            }
         }
 
         bool passesTrackVeto{false}; 
-        if ((map.findable.size() == 1) && recoilIsFindable && (p < 1200)) passesTrackVeto = true; 
+        if ((findableCount == 1) && recoilIsFindable && (p < 1200)) passesTrackVeto = true; 
 
 
         TrackerVetoResult result; 
@@ -5,9 +5,10 @@
 #include <cmath>
 
 #include "Event/TriggerResult.h"
-#include "Event/EcalHit.h"
+#include "Event/HitColumns.h"
 #include "EventProc/TriggerProcessor.h"
 #include "Framework/EventProcessor.h"
+#include "Framework/Exception.h"
 #include "DetDescr/EcalHexReadout.h"
 
 namespace ldmx {
@@ -23,46 +24,82 @@ namespace ldmx {
             algoName_ = "LayerSumTrig";
         } else if (mode_ == 1) {
             algoName_ = "CenterTower";
+            towerRadii_ = pSet.getVDouble("tower_radii", {85.});
+            if (towerRadii_.empty() || towerRadii_.size() > MAX_TOWER_RADII) {
+                EXCEPTION_RAISE("TriggerProcessor",
+                        "The center tower trigger needs between 1 and " + std::to_string(MAX_TOWER_RADII) + " tower radii.");
+            }
+            buildTowerMasks();
+        } else {
+            EXCEPTION_RAISE("TriggerProcessor", "Unknown trigger mode " + std::to_string(mode_) + ".");
         }
     }
 
-    void TriggerProcessor::produce(Event& event) {
-
-        /** Grab the Ecal hit collection for the given event */
-        const TClonesArray *ecalDigis = event.getCollection("ecalDigis");
-        int numEcalHits = ecalDigis->GetEntriesFast();
+    void TriggerProcessor::buildTowerMasks() {
 
-        std::vector<double> layerDigiE(100, 0.0); // big empty vector..
+        EcalHexReadout hexReadout;
+        cellsPerModule_ = hexReadout.getCellPositionMap().size();
+        unsigned nModules = hexReadout.getModulePositionMap().size();
 
-        /** Loop over all ecal hits in the given event */
-        for (int iHit = 0; iHit < numEcalHits; ++iHit) {
-            EcalHit *hit = (EcalHit*) ecalDigis->At(iHit);
-            if (hit->getLayer() < layerDigiE.size()) { // just to be safe...
-                if (mode_ == 0) { // Sum over all cells in a given layer
-                    layerDigiE[hit->getLayer()] += hit->getEnergy();
-                } else if (mode_ == 1) { // Sum over cells in central tower only
-                    //std::pair<float, float> xyPos = hit->getCellCentroidXYPair(hit->getID());
-                    //float cellRadius = sqrt(pow(xyPos.first, 2) + pow(xyPos.second, 2));
-                    //if (cellRadius < MAGICNUMBERHERE) {
-                    //    layerDigiE[hit->getLayer()] += hit->getEnergy();
-                    //}
-                }
+        towerMasks_.assign(nModules*cellsPerModule_, 0);
+        for (auto const& cell : hexReadout.getCellModulePositionMap()) {
+            std::pair<int, int> cellModule = hexReadout.separateID(cell.first);
+            double radius = std::sqrt(cell.second.first*cell.second.first + cell.second.second*cell.second.second);
+            uint32_t mask = 0;
+            for (std::size_t iRadius = 0; iRadius < towerRadii_.size(); ++iRadius) {
+                if (radius < towerRadii_[iRadius]) mask |= (1u << iRadius);
             }
+            towerMasks_[cellModule.second*cellsPerModule_ + cellModule.first] = mask;
         }
+    }
+
+    void TriggerProcessor::produce(Event& event) {
+
+        /** Grab the Ecal hits of the given event as columns */
+        const HitColumns& ecalDigis = event.getHitColumns("ecalDigis");
+        const std::vector<int>& ids = ecalDigis.getIDs();
+        const std::vector<float>& energies = ecalDigis.getEnergies();
+        int numEcalHits = ecalDigis.size();
 
         float layerSum = 0;
+        float towerSums[MAX_TOWER_RADII] = {0};
         bool pass = false;
 
-        for (int iL = startLayer_; iL < endLayer_; ++iL) {
-            layerSum += layerDigiE[iL];
+        /** Loop over all ecal hits in the given event */
+        if (mode_ == 0) { // Sum over all cells in the trigger layers
+            int startLayer = startLayer_;
+            int endLayer = endLayer_;
+            for (int iHit = 0; iHit < numEcalHits; ++iHit) {
+                int layer = (ids[iHit] & 0xFF0) >> 4;
+                layerSum += (layer >= startLayer && layer < endLayer) ? energies[iHit] : 0.f;
+            }
+        } else if (mode_ == 1) { // Sum over cells in the center towers only
+            int startLayer = startLayer_;
+            int endLayer = endLayer_;
+            int nRadii = towerRadii_.size();
+            unsigned nCells = towerMasks_.size();
+            const uint32_t* towerMasks = towerMasks_.data();
+            for (int iHit = 0; iHit < numEcalHits; ++iHit) {
+                int layer = (ids[iHit] & 0xFF0) >> 4;
+                unsigned cell = denseCellIndex(ids[iHit]);
+                uint32_t mask = (layer >= startLayer && layer < endLayer && cell < nCells) ? towerMasks[cell] : 0;
+                for (int iRadius = 0; iRadius < nRadii; ++iRadius) {
+                    towerSums[iRadius] += ((mask >> iRadius) & 1) ? energies[iHit] : 0.f;
+                }
+            }
+            layerSum = towerSums[0];
         }
 
         pass = (layerSum <= layerESumCut_);
 
-        result_.set(algoName_, pass, 3);
+        int nTowerSums = (mode_ == 1) ? towerRadii_.size() : 0;
+        result_.set(algoName_, pass, 3 + nTowerSums);
         result_.setAlgoVar(0, layerSum);
         result_.setAlgoVar(1, layerESumCut_);
         result_.setAlgoVar(2, endLayer_ - startLayer_);
+        for (int iRadius = 0; iRadius < nTowerSums; ++iRadius) {
+            result_.setAlgoVar(3 + iRadius, towerSums[iRadius]);
+        }
 
         event.addToCollection("Trigger", result_);
 
@@ -0,0 +1,111 @@
+// LDMX
+#include "Event/FindableTrackResult.h"
+#include "EventProc/FindableTrackProcessor.h"
+
+// STL
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ldmx::FindableTrackProcessor;
+using ldmx::FindableTrackResult;
+
+/**
+ * The strategy checks on the hit counts per layer, as done by the
+ * FindableTrackProcessor before it switched to layer masks.
+ */
+void isFindableByCounts(FindableTrackResult* result, const std::vector<int>& hitCount) {
+
+    std::vector<int> hit3dVec{0, 0, 0, 0};
+    int hit3dCount{0};
+    for (int layerN = 0; layerN < 8; layerN += 2) {
+        if (hitCount[layerN]*hitCount[layerN+1] != 0) {
+            hit3dCount++;
+            hit3dVec[layerN/2]++;
+        }
+    }
+
+    bool trackFound{false};
+    if (hit3dCount == 4) {
+        result->setResult(FindableTrackResult::STRATEGY_4S, true);
+        trackFound = true;
+    }
+
+    if ((hit3dVec[0]*hit3dVec[1]*hit3dVec[2] > 0) && (hitCount[8] > 0 || hitCount[9] > 0)) {
+        result->setResult(FindableTrackResult::STRATEGY_3S1A, true);
+        trackFound = true;
+    }
+
+    if (hit3dVec[0]*hit3dVec[1] > 0 && (hitCount[8] > 0 && hitCount[9] > 0)) {
+        result->setResult(FindableTrackResult::STRATEGY_2S2A, true);
+        trackFound = true;
+    }
+
+    if (hitCount[8] > 0 && hitCount[9] > 0) {
+        result->setResult(FindableTrackResult::STRATEGY_2A, true);
+        trackFound = true;
+    }
+
+    if (hit3dVec[0]*hit3dVec[1] > 0) {
+        result->setResult(FindableTrackResult::STRATEGY_2S, true);
+        trackFound = true;
+    }
+
+    if (hit3dVec[0]*hit3dVec[1]*hit3dVec[2] > 0) {
+        result->setResult(FindableTrackResult::STRATEGY_3S, true);
+        trackFound = true;
+    }
+
+    if (!trackFound) {
+        result->setResult(FindableTrackResult::STRATEGY_NONE, false);
+    }
+}
+
+/** @return The findable flags of a result, one character per strategy. */
+std::string flags(FindableTrackResult& result) {
+    std::string flags;
+    for (bool flag : {result.is4sFindable(), result.is3s1aFindable(), result.is2s2aFindable(),
+                      result.is2aFindable(), result.is2sFindable(), result.is3sFindable()}) {
+        flags += flag ? '1' : '0';
+    }
+    return flags;
+}
+
+/**
+ * Check that the strategies evaluated on layer masks agree with the checks
+ * on hit counts for every pattern of hit layers in the recoil tracker.
+ */
+int main() {
+
+    std::cout << "Hello FindableTrackProcessor layer mask test!" << std::endl;
+
+    const int nLayers = 10;
+    int nFindable = 0;
+    for (unsigned layerMask = 0; layerMask < (1u << nLayers); ++layerMask) {
+
+        // Layers can have more than one hit, only whether they are hit matters.
+        std::vector<int> hitCount(nLayers, 0);
+        for (int layer = 0; layer < nLayers; ++layer) {
+            if (layerMask & (1u << layer)) {
+                hitCount[layer] = 1 + (layerMask + layer) % 3;
+            }
+        }
+
+        FindableTrackResult fromMask;
+        FindableTrackProcessor::isFindable(&fromMask, layerMask);
+        FindableTrackResult fromCounts;
+        isFindableByCounts(&fromCounts, hitCount);
+
+        if (flags(fromMask) != flags(fromCounts)) {
+            throw std::runtime_error("Layer pattern " + std::to_string(layerMask) + " gives strategies "
+                    + flags(fromMask) + " from the mask but " + flags(fromCounts) + " from the hit counts");
+        }
+        if (flags(fromMask) != "000000") ++nFindable;
+    }
+
+    std::cout << "All " << (1u << nLayers) << " layer patterns agree, " << nFindable
+              << " of them are findable" << std::endl;
+
+    std::cout << "Bye FindableTrackProcessor layer mask test!" << std::endl;
+}
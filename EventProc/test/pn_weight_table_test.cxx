@@ -0,0 +1,88 @@
+// LDMX
+#include "EventProc/PnWeightTable.h"
+
+// ROOT
+#include "TF1.h"
+
+// STL
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ldmx::PnWeightTable;
+
+/**
+ * Compare a table to the ratio of the TF1 fits, with the same formulas as
+ * the PnWeightProcessor used before the weights were tabulated.
+ */
+void checkTable(const PnWeightTable& table, const std::vector<double>& low, const std::vector<double>& high,
+        double wMin, double wMax, double tolerance) {
+
+    TF1 lFit("lfit", "exp([1]-[0]*x)", 950, 1150);
+    lFit.SetParameters(low.data());
+
+    std::string func = "exp([1]-[0]*x)*([2]+[3]*x + [4]*pow(x,2)";
+    func += " + [5]*pow(x,3) + [6]*pow(x,4) + [7]*pow(x,5) + [8]*pow(x,6))";
+    TF1 hFit("hfit", func.c_str(), 1150, 3700);
+    hFit.SetParameters(high.data());
+
+    std::cout << "Table with " << table.getIntervals() << " intervals, deviation "
+              << table.getMaxDeviation() << std::endl;
+
+    // Inside the table, the interpolation must stay within the tolerance.
+    const int nPoints = 100000;
+    double maxDeviation = 0;
+    for (int i = 0; i < nPoints; ++i) {
+        double w = wMin + (wMax - wMin)*(i + 0.5)/nPoints;
+        double expected = lFit.Eval(w)/hFit.Eval(w);
+        double deviation = std::fabs(table.evaluate(w) - expected)/std::fabs(expected);
+        if (deviation > maxDeviation) maxDeviation = deviation;
+    }
+    std::cout << "Largest deviation from the TF1 fits inside the table: " << maxDeviation << std::endl;
+    if (maxDeviation > tolerance) {
+        throw std::runtime_error("Table deviates from the TF1 fits by " + std::to_string(maxDeviation));
+    }
+
+    // Outside of the table, the fits are evaluated directly.
+    for (double w : {900., wMin - 1, wMax, wMax + 1, 5000.}) {
+        double expected = lFit.Eval(w)/hFit.Eval(w);
+        double deviation = std::fabs(table.evaluate(w) - expected)/std::fabs(expected);
+        if (deviation > 1e-12) {
+            throw std::runtime_error("Fallback deviates from the TF1 fits at W = " + std::to_string(w));
+        }
+    }
+    std::cout << "Fallback outside of the table okay" << std::endl;
+}
+
+int main(int, const char* argv[]) {
+
+    std::cout << "Hello PnWeightTable test!" << std::endl;
+
+    // Default fits and range
+    PnWeightTable defaultTable;
+    checkTable(defaultTable, PnWeightTable::DEFAULT_LOW_FIT_PARAMETERS,
+            PnWeightTable::DEFAULT_HIGH_FIT_PARAMETERS, 1150, 3700, 1e-5);
+
+    // Other fit parameters and a tighter tolerance
+    std::vector<double> low{0.0105, 2.7};
+    std::vector<double> high = PnWeightTable::DEFAULT_HIGH_FIT_PARAMETERS;
+    high[0] = 0.0041;
+    PnWeightTable customTable(low, high, 1200, 3000, 1e-7);
+    checkTable(customTable, low, high, 1200, 3000, 1e-7);
+
+    // Fits with the wrong number of parameters are rejected
+    bool rejected = false;
+    try {
+        PnWeightTable badTable(std::vector<double>{1.}, high);
+    } catch (...) {
+        rejected = true;
+    }
+    if (!rejected) {
+        throw std::runtime_error("Fit with the wrong number of parameters was accepted");
+    }
+    std::cout << "Wrong number of parameters rejected okay" << std::endl;
+
+    std::cout << "Bye PnWeightTable test!" << std::endl;
+}
@@ -0,0 +1,411 @@
+/**
+ * @file ldmx_bench.cxx
+ * @brief Benchmark of event processors running over synthetic events
+ *
+ * @note
+ * The processor sequence is read from a regular python configuration
+ * script, but instead of reading events from a file, events containing
+ * simulated ECal, HCal and tracker hits and sim particles are generated in
+ * memory.  The event rate, the time spent in each processor and the peak
+ * resident memory of the job are reported for each point of the hit
+ * multiplicity sweep.
+ */
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+
+//----------//
+//   ROOT   //
+//----------//
+#include "TClonesArray.h"
+#include "TRandom3.h"
+
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "DetDescr/EcalDetectorID.h"
+#include "DetDescr/EcalHexReadout.h"
+#include "DetDescr/HcalID.h"
+#include "DetDescr/TrackerID.h"
+#include "Event/EventConstants.h"
+#include "Event/EventHeader.h"
+#include "Event/SimCalorimeterHit.h"
+#include "Event/SimParticle.h"
+#include "Event/SimTrackerHit.h"
+#include "Framework/ConfigurePython.h"
+#include "Framework/EventImpl.h"
+#include "Framework/EventProcessor.h"
+#include "Framework/Process.h"
+
+using namespace ldmx;
+
+namespace {
+
+    /** Pass name of the synthetic collections, matching the simulation output. */
+    const std::string SIM_PASS = "sim";
+
+    /** Subdetector IDs, matching the detector descriptions. */
+    const int TAGGER_SUBDET_ID = 1;
+    const int RECOIL_SUBDET_ID = 5;
+    const int ECAL_SUBDET_ID = 6;
+    const int HCAL_SUBDET_ID = 7;
+
+    /** Approximate ECal geometry [mm]. */
+    const int ECAL_LAYERS = 34;
+    const double ECAL_FRONT_Z = 223.8;
+    const double ECAL_LAYER_PITCH = 14.0;
+
+    /** Approximate HCal geometry [mm]. */
+    const int HCAL_LAYERS = 100;
+    const int HCAL_STRIPS = 31;
+    const double HCAL_FRONT_Z = 504.0;
+    const double HCAL_LAYER_PITCH = 45.0;
+    const double HCAL_HALF_WIDTH = 1500.0;
+
+    /** Number of layers in the tagger and recoil trackers. */
+    const int TAGGER_LAYERS = 14;
+    const int RECOIL_LAYERS = 10;
+
+    /**
+     * @struct Multiplicity
+     * @brief Number of objects generated per event for one point of the sweep
+     */
+    struct Multiplicity {
+        int ecalHits{1000};
+        int hcalHits{100};
+        int trackerHits{20};
+        int particles{50};
+    };
+
+    /**
+     * @class SyntheticEventGenerator
+     * @brief Fills sim hit and sim particle collections with random content
+     */
+    class SyntheticEventGenerator {
+
+        public:
+
+            SyntheticEventGenerator(unsigned seed) :
+                random_(seed),
+                simParticles_(new TClonesArray(EventConstants::SIM_PARTICLE.c_str(), 1000)),
+                ecalSimHits_(new TClonesArray(EventConstants::SIM_CALORIMETER_HIT.c_str(), 10000)),
+                hcalSimHits_(new TClonesArray(EventConstants::SIM_CALORIMETER_HIT.c_str(), 1000)),
+                recoilSimHits_(new TClonesArray(EventConstants::SIM_TRACKER_HIT.c_str(), 1000)),
+                taggerSimHits_(new TClonesArray(EventConstants::SIM_TRACKER_HIT.c_str(), 1000)) {
+
+                // Cache the absolute cell centers so hits can be placed on
+                // real cells without searching the hexagonal grid.
+                for (const auto& cell : hexReadout_.getCellModulePositionMap()) {
+                    cellModuleIDs_.push_back(cell.first);
+                    cellCenters_.push_back(cell.second);
+                }
+                ecalID_.setFieldValue(0, ECAL_SUBDET_ID);
+                hcalID_.setFieldValue(0, HCAL_SUBDET_ID);
+            }
+
+            ~SyntheticEventGenerator() {
+                delete simParticles_;
+                delete ecalSimHits_;
+                delete hcalSimHits_;
+                delete recoilSimHits_;
+                delete taggerSimHits_;
+            }
+
+            /**
+             * Generate the collections of an event and add them to it.
+             * @param event The event to fill.
+             * @param mult The number of objects to generate.
+             */
+            void fill(EventImpl& event, const Multiplicity& mult) {
+                fillParticles(mult.particles);
+                fillEcal(mult.ecalHits);
+                fillHcal(mult.hcalHits);
+                fillTracker(recoilSimHits_, RECOIL_SUBDET_ID, RECOIL_LAYERS, mult.trackerHits);
+                fillTracker(taggerSimHits_, TAGGER_SUBDET_ID, TAGGER_LAYERS, mult.trackerHits);
+
+                event.add(EventConstants::SIM_PARTICLES, simParticles_);
+                event.add(EventConstants::ECAL_SIM_HITS, ecalSimHits_);
+                event.add(EventConstants::HCAL_SIM_HITS, hcalSimHits_);
+                event.add(EventConstants::RECOIL_SIM_HITS, recoilSimHits_);
+                event.add(EventConstants::TAGGER_SIM_HITS, taggerSimHits_);
+            }
+
+        private:
+
+            /**
+             * The first particle is the recoil electron which radiates a
+             * photon, and the rest are the products of a photo-nuclear
+             * reaction of that photon.
+             */
+            void fillParticles(int nParticles) {
+
+                static const int PN_PDG_IDS[] = {2112, 2212, 211, -211, 111, 22};
+
+                SimParticle* recoil = (SimParticle*) simParticles_->ConstructedAt(0);
+                recoil->setTrackID(1);
+                recoil->setPdgID(11);
+                recoil->setGenStatus(1);
+                recoil->setCharge(-1);
+                recoil->setMass(0.511);
+                recoil->setMomentum(random_.Gaus(0, 10), random_.Gaus(0, 10), random_.Uniform(50, 1200));
+                recoil->setEnergy(recoil->getMomentum()[2]);
+                recoil->setEndPoint(0, 0, ECAL_FRONT_Z);
+
+                if (nParticles < 2) return;
+
+                SimParticle* gamma = (SimParticle*) simParticles_->ConstructedAt(1);
+                gamma->setTrackID(2);
+                gamma->setPdgID(22);
+                gamma->setGenStatus(0);
+                gamma->setProcessType(SimParticle::ProcessType::eBrem);
+                gamma->setMomentum(0, 0, random_.Uniform(2800, 4000));
+                gamma->setEnergy(gamma->getMomentum()[2]);
+                gamma->setEndPoint(0, 0, ECAL_FRONT_Z + ECAL_LAYER_PITCH*random_.Uniform(0, 10));
+                recoil->addDaughter(gamma);
+                gamma->addParent(recoil);
+
+                for (int iParticle = 2; iParticle < nParticles; ++iParticle) {
+                    SimParticle* particle = (SimParticle*) simParticles_->ConstructedAt(iParticle);
+                    particle->setTrackID(iParticle + 1);
+                    particle->setPdgID(PN_PDG_IDS[random_.Integer(6)]);
+                    particle->setGenStatus(0);
+                    particle->setProcessType(SimParticle::ProcessType::photonNuclear);
+                    particle->setMomentum(random_.Gaus(0, 200), random_.Gaus(0, 200), random_.Gaus(0, 400));
+                    particle->setMass(random_.Uniform(0, 940));
+                    particle->setEnergy(particle->getMass() + random_.Exp(100));
+                    particle->setVertex(0, 0, gamma->getEndPoint()[2]);
+                    gamma->addDaughter(particle);
+                    particle->addParent(gamma);
+                }
+            }
+
+            /** Place hits on random cells of the hexagonal readout. */
+            void fillEcal(int nHits) {
+                for (int iHit = 0; iHit < nHits; ++iHit) {
+                    int layer = random_.Integer(ECAL_LAYERS);
+                    int icell = random_.Integer(cellModuleIDs_.size());
+                    std::pair<int, int> cellModule = hexReadout_.separateID(cellModuleIDs_[icell]);
+                    ecalID_.setFieldValue(1, layer);
+                    ecalID_.setFieldValue(2, cellModule.second);
+                    ecalID_.setFieldValue(3, cellModule.first);
+
+                    SimCalorimeterHit* hit = (SimCalorimeterHit*) ecalSimHits_->ConstructedAt(iHit);
+                    hit->setID(ecalID_.pack());
+                    hit->setPosition(cellCenters_[icell].first, cellCenters_[icell].second,
+                            ECAL_FRONT_Z + ECAL_LAYER_PITCH*layer);
+                    addContrib(hit, random_.Exp(0.5));
+                }
+            }
+
+            /** Place hits on random strips of the HCal, mostly in the back section. */
+            void fillHcal(int nHits) {
+                for (int iHit = 0; iHit < nHits; ++iHit) {
+                    int section = (random_.Rndm() < 0.8) ? HcalSection::BACK : 1 + random_.Integer(4);
+                    int layer = 1 + random_.Integer(HCAL_LAYERS);
+                    hcalID_.setFieldValue(1, layer);
+                    hcalID_.setFieldValue(2, section);
+                    hcalID_.setFieldValue(3, random_.Integer(HCAL_STRIPS));
+
+                    SimCalorimeterHit* hit = (SimCalorimeterHit*) hcalSimHits_->ConstructedAt(iHit);
+                    hit->setID(hcalID_.pack());
+                    hit->setPosition(random_.Uniform(-HCAL_HALF_WIDTH, HCAL_HALF_WIDTH),
+                            random_.Uniform(-HCAL_HALF_WIDTH, HCAL_HALF_WIDTH),
+                            HCAL_FRONT_Z + HCAL_LAYER_PITCH*layer);
+                    addContrib(hit, random_.Exp(1.0));
+                }
+            }
+
+            /** Create tracker hits on random layers, each linked to a sim particle. */
+            void fillTracker(TClonesArray* hits, int subdetID, int nLayers, int nHits) {
+                int nParticles = simParticles_->GetEntriesFast();
+                for (int iHit = 0; iHit < nHits; ++iHit) {
+                    int layer = 1 + random_.Integer(nLayers);
+                    int module = random_.Integer(2);
+                    trackerID_.setFieldValue(0, subdetID);
+                    trackerID_.setFieldValue(1, layer);
+                    trackerID_.setFieldValue(2, module);
+
+                    SimParticle* particle = (SimParticle*) simParticles_->At(random_.Integer(nParticles));
+
+                    SimTrackerHit* hit = (SimTrackerHit*) hits->ConstructedAt(iHit);
+                    hit->setID(trackerID_.pack());
+                    hit->setLayerID(layer);
+                    hit->setModuleID(module);
+                    hit->setPosition(random_.Gaus(0, 20), random_.Gaus(0, 20), 10.0*layer);
+                    hit->setEdep(random_.Landau(0.1, 0.02));
+                    hit->setTime(random_.Uniform(0, 2));
+                    hit->setMomentum(random_.Gaus(0, 10), random_.Gaus(0, 10), random_.Uniform(50, 4000));
+                    hit->setTrackID(particle->getTrackID());
+                    hit->setPdgID(particle->getPdgID());
+                    hit->setSimParticle(particle);
+                }
+            }
+
+            /** Attribute the energy of a calorimeter hit to a random particle. */
+            void addContrib(SimCalorimeterHit* hit, float edep) {
+                SimParticle* particle = (SimParticle*) simParticles_->At(random_.Integer(simParticles_->GetEntriesFast()));
+                hit->addContrib(particle, particle->getPdgID(), edep, random_.Uniform(0, 20));
+            }
+
+        private:
+
+            TRandom3 random_;
+
+            EcalHexReadout hexReadout_;
+            std::vector<int> cellModuleIDs_;
+            std::vector<XYCoords> cellCenters_;
+
+            EcalDetectorID ecalID_;
+            HcalID hcalID_;
+            TrackerID trackerID_;
+
+            TClonesArray* simParticles_;
+            TClonesArray* ecalSimHits_;
+            TClonesArray* hcalSimHits_;
+            TClonesArray* recoilSimHits_;
+            TClonesArray* taggerSimHits_;
+    };
+
+    /** Parse a comma separated list of integers. */
+    std::vector<int> parseList(const char* arg) {
+        std::vector<int> values;
+        std::stringstream ss(arg);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            values.push_back(atoi(item.c_str()));
+        }
+        return values;
+    }
+
+    /** Get the i-th sweep value of a list, reusing the last value if the list is shorter. */
+    int sweepValue(const std::vector<int>& values, size_t i) {
+        return values[std::min(i, values.size() - 1)];
+    }
+
+    /** @return The peak resident set size of the process [MB]. */
+    double peakRSS() {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss/1024.0;
+    }
+
+    void printUsage() {
+        printf("Usage: ldmx-bench [-n events] [-e ecalHits] [-c hcalHits] [-t trackerHits] [-p particles] [-s seed]"
+               " {configuration_script.py} [arguments to configuration script]\n");
+        printf("  Hit and particle multiplicities may be comma separated lists to run a sweep.\n");
+    }
+}
+
+int main(int argc, char* argv[]) {
+
+    int nEvents{1000};
+    unsigned seed{1};
+    std::vector<int> ecalHits{1000}, hcalHits{100}, trackerHits{20}, particles{50};
+
+    int iarg = 1;
+    for (; iarg < argc && !strstr(argv[iarg], ".py"); iarg++) {
+        if (iarg + 1 == argc) break;
+        if (!strcmp(argv[iarg], "-n")) nEvents = atoi(argv[++iarg]);
+        else if (!strcmp(argv[iarg], "-s")) seed = atoi(argv[++iarg]);
+        else if (!strcmp(argv[iarg], "-e")) ecalHits = parseList(argv[++iarg]);
+        else if (!strcmp(argv[iarg], "-c")) hcalHits = parseList(argv[++iarg]);
+        else if (!strcmp(argv[iarg], "-t")) trackerHits = parseList(argv[++iarg]);
+        else if (!strcmp(argv[iarg], "-p")) particles = parseList(argv[++iarg]);
+        else break;
+    }
+
+    if (iarg >= argc || !strstr(argv[iarg], ".py")) {
+        printUsage();
+        return 0;
+    }
+
+    if (ecalHits.empty() || hcalHits.empty() || trackerHits.empty() || particles.empty()) {
+        printUsage();
+        return 1;
+    }
+
+    try {
+        ConfigurePython cfg(argv[iarg], argv + iarg + 1, argc - iarg - 1);
+        Process* p = cfg.makeProcess();
+        const std::vector<EventProcessor*>& sequence = p->getSequence();
+
+        for (auto module : sequence) {
+            module->onProcessStart();
+        }
+
+        size_t nPoints = std::max(std::max(ecalHits.size(), hcalHits.size()),
+                std::max(trackerHits.size(), particles.size()));
+
+        SyntheticEventGenerator generator(seed);
+        EventHeader header;
+        for (size_t ipoint = 0; ipoint < nPoints; ++ipoint) {
+
+            Multiplicity mult;
+            mult.ecalHits = sweepValue(ecalHits, ipoint);
+            mult.hcalHits = sweepValue(hcalHits, ipoint);
+            mult.trackerHits = sweepValue(trackerHits, ipoint);
+            mult.particles = std::max(1, sweepValue(particles, ipoint));
+
+            EventImpl theEvent(SIM_PASS);
+            std::vector<double> moduleTime(sequence.size(), 0);
+            double totalTime{0};
+
+            for (int ievent = 0; ievent < nEvents; ++ievent) {
+                header.setRun(1);
+                header.setEventNumber(ievent + 1);
+                theEvent.add(EventConstants::EVENT_HEADER, &header);
+                generator.fill(theEvent, mult);
+                theEvent.nextEvent();
+                p->getStorageController().resetEventState();
+
+                for (size_t imodule = 0; imodule < sequence.size(); ++imodule) {
+                    auto start = std::chrono::steady_clock::now();
+                    EventProcessor* module = sequence[imodule];
+                    if (dynamic_cast<Producer*>(module)) {
+                        (dynamic_cast<Producer*>(module))->produce(theEvent);
+                    } else if (dynamic_cast<Analyzer*>(module)) {
+                        (dynamic_cast<Analyzer*>(module))->analyze(theEvent);
+                    }
+                    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+                    moduleTime[imodule] += elapsed.count();
+                    totalTime += elapsed.count();
+                }
+
+                theEvent.Clear();
+                theEvent.onEndOfEvent();
+            }
+
+            std::cout << "---- ldmx-bench: " << nEvents << " events with " << mult.ecalHits << " ECal hits, "
+                      << mult.hcalHits << " HCal hits, " << mult.trackerHits << " tracker hits and "
+                      << mult.particles << " particles --------" << std::endl;
+            std::cout << std::fixed << std::setprecision(3);
+            for (size_t imodule = 0; imodule < sequence.size(); ++imodule) {
+                std::cout << "  " << std::setw(30) << std::left << sequence[imodule]->getName() << std::right
+                          << std::setw(12) << 1e6*moduleTime[imodule]/nEvents << " us/event" << std::endl;
+            }
+            std::cout << "  Rate: " << ((totalTime > 0) ? nEvents/totalTime : 0) << " events/s" << std::endl;
+            std::cout << "  Peak RSS: " << peakRSS() << " MB" << std::endl;
+        }
+
+        for (auto module : sequence) {
+            module->onProcessEnd();
+        }
+
+    } catch (Exception& e) {
+        std::cerr << "Framework Error [" << e.name() << "] : " << e.message() << std::endl;
+        std::cerr << "  at " << e.module() << ":" << e.line() << " in " << e.function() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -13,10 +13,12 @@
 
 // LDMX
 #include "Event/Event.h"
+#include "Event/SimParticleResolver.h"
 
 // STL
 #include <string>
 #include <map>
+#include <memory>
 #include <set>
 
 class TTree;
@@ -97,6 +99,30 @@ namespace ldmx {
              */
             virtual const TObject* getReal(const std::string& collectionName, const std::string& passName, bool mustExist) const;
 
+            /**
+             * Get a hit collection as columns, converting TClonesArray collections
+             * at most once per event.
+             * @param collectionName The collection name.
+             * @param passName The pass name.
+             * @return The hits as columns.
+             */
+            virtual const HitColumns* getHitColumnsReal(const std::string& collectionName, const std::string& passName) const;
+
+            /**
+             * Get a derived object cached during the current event.
+             * @param tag The type of the tag identifying the derived object.
+             * @return The cached derived object or null if there is none.
+             */
+            virtual const DerivedObjectBase* getDerivedReal(const std::type_index& tag) const;
+
+            /**
+             * Cache a derived object until the next event.
+             * @param tag The type of the tag identifying the derived object.
+             * @param obj The derived object (ownership is taken).
+             * @return The cached derived object.
+             */
+            virtual const DerivedObjectBase* setDerivedReal(const std::type_index& tag, DerivedObjectBase* obj) const;
+
         public:
 
             /** ********* Functionality for storage  ********** **/
@@ -159,7 +185,9 @@ namespace ldmx {
             bool nextEvent();
 
             /**
-             * Action to be executed before the tree is filled.
+             * Action to be executed before the tree is filled.  When skimming,
+             * the SimParticle links of the copied input collections are resolved
+             * so links read from old files are written out as track IDs.
              */
             void beforeFill();
 
@@ -186,6 +214,16 @@ namespace ldmx {
                 return passName_;
             }
 
+        private:
+
+            /**
+             * Fill the transient SimParticle links of a collection read from 
+             * the input tree.  This is done at most once per branch and event.
+             * @param branchName The name of the branch.
+             * @param obj The object read from the branch.
+             */
+            void resolveLinks(const std::string& branchName, TObject* obj) const;
+
         private:
 
             /**
@@ -253,6 +291,42 @@ namespace ldmx {
              * Efficiency cache for empty pass name lookups.
              */
             mutable std::map<std::string, std::string> knownLookups_;
+
+            /**
+             * Objects derived from the event data, which are cleared when
+             * moving to the next event.
+             */
+            mutable std::map<std::type_index, std::unique_ptr<DerivedObjectBase>> derived_;
+
+            /**
+             * Track ID lookup used to resolve SimParticle links of input collections.
+             */
+            mutable SimParticleResolver resolver_;
+
+            /**
+             * Flag indicating the resolver has been built for the current event.
+             */
+            mutable bool resolverBuilt_{false};
+
+            /**
+             * Flag indicating the resolver is reading the particles of the current event.
+             */
+            mutable bool resolverBuilding_{false};
+
+            /**
+             * Names of the input branches already resolved in the current event.
+             */
+            mutable std::set<std::string> resolved_;
+
+            /**
+             * Columns converted from TClonesArray collections, reused across events.
+             */
+            mutable std::map<const TObject*, std::unique_ptr<HitColumns>> columns_;
+
+            /**
+             * Collections converted to columns in the current event.
+             */
+            mutable std::set<const TObject*> columnsFilled_;
     };
 
 }
@@ -102,6 +102,14 @@ namespace ldmx {
             virtual void onProcessEnd() {
             }
 
+            /**
+             * Get the name of this instance of the processor.
+             * @return The name of the EventProcessor.
+             */
+            const std::string& getName() const {
+                return name_;
+            }
+
             /** Access/create a directory in the histogram file for this event
              * processor to create histograms and analysis tuples.
              * @note This method makes the returned directory the current directory
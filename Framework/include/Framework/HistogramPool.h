@@ -11,7 +11,10 @@
 //   C++ StdLib   //
 //----------------//
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 #include <iostream>
 
 // Forward declarations
@@ -19,6 +22,21 @@ class TH1;
 
 namespace ldmx { 
 
+    /**
+     * @class HistogramPool
+     * @brief Pool of histograms shared by all processors.
+     *
+     * @note
+     * Histograms are created once through create(), before any worker thread
+     * starts, and are written to the histogram file by the Process.  The
+     * thread that created the pool fills the master histograms.  Any other
+     * thread is attached as a worker the first time it calls get(), and from
+     * then on gets clones of the histograms as booked that are only filled
+     * by that thread, so no locking is needed while filling.
+     * The clones are added to the master histograms in the order the workers
+     * were attached when mergeWorkers() is called, which happens before the
+     * histogram file is written.
+     */
     class HistogramPool {
 
         private: 
@@ -26,16 +44,47 @@ namespace ldmx {
             /** Container for all histograms. */
             std::unordered_map< std::string, TH1* > histograms_;
 
+            /** Empty copies of the histograms as booked, used to make worker clones. */
+            std::unordered_map< std::string, std::unique_ptr<TH1> > templates_;
+
+            /** Histogram clones owned by each worker thread in attach order. */
+            std::vector<std::unique_ptr<std::unordered_map< std::string, TH1* >>> workerHistograms_;
+
+            /** Histogram clones of the calling thread, null if it is not a worker. */
+            static thread_local std::unordered_map< std::string, TH1* >* threadHistograms_;
+
+            /** Mutex guarding the histogram insertion, worker clones and merging. */
+            std::mutex mutex_;
+
+            /** The thread that created the pool and fills the master histograms. */
+            std::thread::id masterThread_;
+
             /** HistogramPool singlenton. */
             static HistogramPool* instance;
 
             /** Private constructor to prevent instantiation */
             HistogramPool(); 
 
+            /** Insert a newly created histogram into the pool. */
+            void insert(const std::string& name, TH1* hist);
+
+            /** Register the calling thread as a worker. */
+            void attachWorker();
+
+            /** Clone a master histogram for the calling worker thread. */
+            TH1* createWorkerClone(const std::string& name);
+
         public: 
 
             static HistogramPool* getInstance();  
 
+            /**
+             * Add the histograms filled by all workers to the master 
+             * histograms and reset the worker histograms.  This must be 
+             * called while the workers aren't filling histograms.
+             */
+            void mergeWorkers();
+
             /**
              * Create a ROOT 1D histogram of type T and pool it for later use.
              *
@@ -61,7 +110,7 @@ namespace ldmx {
                 hist->GetXaxis()->CenterTitle(); 
 
                 // Insert it into the pool of histograms for later use
-                histograms_[name] = hist; 
+                insert(name, hist); 
             }
 
             /**
@@ -99,11 +148,13 @@ namespace ldmx {
                 hist->GetYaxis()->CenterTitle(); 
 
                 // Insert it into the pool of histograms for later use
-                histograms_[name] = hist; 
+                insert(name, hist); 
             }
 
             /** 
-             * @return Retrieve the histogram named "name" from the pool. 
+             * @return Retrieve the histogram named "name" from the pool.  If 
+             *         the calling thread is a worker, its own clone of the 
+             *         histogram is returned.
              */
             TH1* get(const std::string& name);
 
@@ -52,6 +52,14 @@ namespace ldmx {
              */
             void addToSequence(EventProcessor* evtproc);
 
+            /**
+             * Get the linear sequence of processors run in this job.
+             * @return The ordered list of EventProcessors.
+             */
+            const std::vector<EventProcessor*>& getSequence() const {
+                return sequence_;
+            }
+
             /**
              * Add an input file name to the list.
              * @param filename Input ROOT event file name
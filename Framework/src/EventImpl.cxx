@@ -2,6 +2,7 @@
 #include "TTree.h"
 #include "TBranchElement.h"
 #include "TBranchClones.h"
+#include "TClass.h"
 
 // LDMX
 #include "Event/EventConstants.h"
@@ -148,8 +149,16 @@ namespace ldmx {
         // check the objects map
         std::map<std::string, TObject*>::const_iterator ito = objects_.find(branchName);
         if (ito != objects_.end()) {
-           if (itb!=branches_.end())
-              itb->second->GetEntry(ientry_);
+           if (itb!=branches_.end()) {
+              // Only read the branch once per entry.  Reading it again would
+              // rerun the schema rules of old files, which reset the links
+              // that were already resolved.
+              if (itb->second->GetReadEntry() != ientry_) {
+                 itb->second->GetEntry(ientry_);
+                 resolved_.erase(branchName);
+              }
+              resolveLinks(branchName, ito->second);
+           }
            return ito->second;
         } else if (inputTree_ == 0) {
             EXCEPTION_RAISE("ProductNotFound", "No product found for name '" + collectionName + "' and pass '" + passName_ + "'");
@@ -167,12 +176,15 @@ namespace ldmx {
                 if (!tbe)
                     itb->second->SetAddress(ito->second);
                 int nr = itb->second->GetEntry(ientry_, 1);
+                resolved_.erase(branchName);
             }
 
             // check the objects map
 
-            if (ito != objects_.end())
+            if (ito != objects_.end()) {
+                resolveLinks(branchName, ito->second);
                 return ito->second;
+            }
 
             // this case is hard to achieve
             return 0;
@@ -199,10 +211,68 @@ namespace ldmx {
             branches_.insert(std::pair<std::string, TBranch*>(branchName, branch));
             objects_.insert(std::pair<std::string, TObject*>(branchName, top));
 
+            resolveLinks(branchName, top);
+
             return top;
         }
     }
 
+    void EventImpl::resolveLinks(const std::string& branchName, TObject* obj) const {
+
+        if (!resolved_.insert(branchName).second) return;
+
+        TClonesArray* tca = dynamic_cast<TClonesArray*>(obj);
+        if (!tca || !SimParticleResolver::hasLinks(tca->GetClass())) return;
+
+        // Build the track ID lookup from the particles of this event on first use.
+        // The particles are resolved by build(), so the nested read of the
+        // particle branch is skipped while building.
+        if (resolverBuilding_) return;
+        if (!resolverBuilt_) {
+            resolverBuilding_ = true;
+            TClonesArray* particles = dynamic_cast<TClonesArray*>(const_cast<TObject*>(
+                    getReal(EventConstants::SIM_PARTICLES, "", false)));
+            resolver_.build(particles);
+            resolverBuilding_ = false;
+            resolverBuilt_ = true;
+            if (tca == particles) return;
+        }
+
+        resolver_.resolve(tca);
+    }
+
+    const HitColumns* EventImpl::getHitColumnsReal(const std::string& collectionName, const std::string& passName) const {
+
+        const TObject* obj = getReal(collectionName, passName, true);
+
+        const HitColumns* columns = dynamic_cast<const HitColumns*>(obj);
+        if (columns) return columns;
+
+        const TClonesArray* tca = dynamic_cast<const TClonesArray*>(obj);
+        if (!tca) {
+            EXCEPTION_RAISE("ProductProblem", "The product '" + collectionName + "' is neither a hit collection nor hit columns.");
+        }
+
+        std::unique_ptr<HitColumns>& converted = columns_[obj];
+        if (!converted) converted.reset(new HitColumns);
+        if (columnsFilled_.insert(obj).second && !converted->fill(tca)) {
+            EXCEPTION_RAISE("ProductProblem", "The hits of the collection '" + collectionName + "' can not be converted to columns.");
+        }
+        return converted.get();
+    }
+
+    const DerivedObjectBase* EventImpl::getDerivedReal(const std::type_index& tag) const {
+        auto it = derived_.find(tag);
+        if (it == derived_.end()) return nullptr;
+        return it->second.get();
+    }
+
+    const DerivedObjectBase* EventImpl::setDerivedReal(const std::type_index& tag, DerivedObjectBase* obj) const {
+        std::unique_ptr<DerivedObjectBase>& slot = derived_[tag];
+        slot.reset(obj);
+        return obj;
+    }
+
     TTree* EventImpl::createTree() {
         outputTree_ = new TTree("LDMX_Events", "LDMX Events");
 
@@ -230,6 +300,10 @@ namespace ldmx {
 
     bool EventImpl::nextEvent() {
         ientry_++;
+        derived_.clear();
+        resolved_.clear();
+        columnsFilled_.clear();
+        resolverBuilt_ = false;
         eventHeader_=get<EventHeader*>(EventConstants::EVENT_HEADER);
         return true;
     }
@@ -238,6 +312,21 @@ namespace ldmx {
         if (inputTree_==0 && branchesFilled_.find(EventConstants::EVENT_HEADER)==branchesFilled_.end()) {
             add(EventConstants::EVENT_HEADER, eventHeader_);
         }
+
+        // The links of old files are converted when a collection is fetched.  A
+        // skim writes out every active input branch, so the collections with
+        // links which no processor fetched are converted before they are copied.
+        if (inputTree_ && outputTree_) {
+            for (const std::string& branchName : branchNames_) {
+                std::size_t split = branchName.find('_');
+                if (split == std::string::npos || resolved_.count(branchName)) continue;
+                TBranchElement* branch = dynamic_cast<TBranchElement*>(inputTree_->GetBranch(branchName.c_str()));
+                if (!branch || !inputTree_->GetBranchStatus(branchName.c_str())) continue;
+                TClass* cl = TClass::GetClass(branch->GetClonesName());
+                if (!cl || !SimParticleResolver::hasLinks(cl)) continue;
+                getReal(branchName.substr(0, split), branchName.substr(split + 1), false);
+            }
+        }
     }
 
     void EventImpl::Clear() {
@@ -245,6 +334,10 @@ namespace ldmx {
         for (auto obj : objects_)
             obj.second->Clear("C");
         branchesFilled_.clear();
+        derived_.clear();
+        resolved_.clear();
+        columnsFilled_.clear();
+        resolverBuilt_ = false;
 
     }
     void EventImpl::onEndOfEvent() {
@@ -15,13 +15,16 @@
 //   ROOT   //
 //----------//
 #include "TH1.h"
+#include "TROOT.h"
 #include "TStyle.h"
 
 namespace ldmx { 
 
     HistogramPool* HistogramPool::instance = nullptr;
 
-    HistogramPool::HistogramPool() {
+    thread_local std::unordered_map< std::string, TH1* >* HistogramPool::threadHistograms_ = nullptr;
+
+    HistogramPool::HistogramPool() : masterThread_(std::this_thread::get_id()) {
         
         gStyle->SetOptStat(0);
         gStyle->SetGridColor(17);
@@ -40,22 +43,83 @@ namespace ldmx {
         
         gStyle->SetHistLineWidth(2); 
 
+        // Make ROOT aware of concurrent filling before any worker can attach.
+        ROOT::EnableThreadSafety(); 
     }
 
     HistogramPool* HistogramPool::getInstance() { 
         
         // Create an instance of HistogramPool if needed
-        if (!instance) instance = new HistogramPool; 
+        static std::once_flag created; 
+        std::call_once(created, []() { instance = new HistogramPool; }); 
 
         return instance; 
     }
 
+    void HistogramPool::insert(const std::string& name, TH1* hist) { 
+
+        // Worker clones are made from an empty copy taken at booking time, 
+        // which isn't attached to any directory and is never filled.
+        TH1* booked = static_cast<TH1*>(hist->Clone()); 
+        booked->SetDirectory(nullptr); 
+        booked->Reset(); 
+
+        std::lock_guard<std::mutex> lock(mutex_); 
+        histograms_[name] = hist; 
+        templates_[name].reset(booked); 
+    }
+
+    void HistogramPool::attachWorker() { 
+        
+        std::lock_guard<std::mutex> lock(mutex_); 
+        workerHistograms_.emplace_back(new std::unordered_map< std::string, TH1* >); 
+        threadHistograms_ = workerHistograms_.back().get(); 
+    }
+
+    TH1* HistogramPool::createWorkerClone(const std::string& name) { 
+        std::lock_guard<std::mutex> lock(mutex_); 
+        
+        auto booked = templates_.find(name); 
+        if (booked == templates_.end()) { 
+            throw std::invalid_argument("Histogram " + name + " not found.");  
+        }  
+
+        // The clone starts out empty and isn't attached to any directory so 
+        // it's never written out by itself.
+        TH1* clone = static_cast<TH1*>(booked->second->Clone()); 
+
+        (*threadHistograms_)[name] = clone;
+        return clone;  
+    }
+
+    void HistogramPool::mergeWorkers() { 
+        std::lock_guard<std::mutex> lock(mutex_); 
+
+        for (auto& worker : workerHistograms_) { 
+            for (auto& clone : *worker) { 
+                histograms_[clone.first]->Add(clone.second); 
+                clone.second->Reset(); 
+            }
+        }
+    }
+
     TH1* HistogramPool::get(const std::string& name) { 
+
+        // Workers only ever touch their own clones 
+        if (threadHistograms_ || std::this_thread::get_id() != masterThread_) { 
+            if (!threadHistograms_) attachWorker(); 
+            auto clone = threadHistograms_->find(name); 
+            if (clone != threadHistograms_->end()) return clone->second; 
+            return createWorkerClone(name); 
+        }
+        
+        // The master histograms are only inserted before the workers start, 
+        // so the owning thread looks them up without locking.
         auto histo = histograms_.find(name); 
         if (histo == histograms_.end()) { 
             throw std::invalid_argument("Histogram " + name + " not found.");  
         }  
         
-        return histograms_[name];
+        return histo->second;
     }
 }
@@ -4,6 +4,7 @@
 #include "Framework/EventProcessor.h"
 #include "Framework/EventImpl.h"
 #include "Framework/EventFile.h"
+#include "Framework/HistogramPool.h"
 #include "Framework/Process.h"
 #include "Event/RunHeader.h"
 
@@ -153,6 +154,8 @@ namespace ldmx {
                 }
 
                 if (histoTFile_) {
+                    // collect histograms filled by worker threads before writing
+                    HistogramPool::getInstance()->mergeWorkers();
                     histoTFile_->Write();
                     delete histoTFile_;
                     histoTFile_ = 0;
@@ -0,0 +1,352 @@
+// LDMX
+#include "Event/EventConstants.h"
+#include "Event/SimCalorimeterHit.h"
+#include "Event/SimParticle.h"
+#include "Framework/EventFile.h"
+#include "Framework/EventImpl.h"
+
+// ROOT
+#include "TClonesArray.h"
+
+// STL
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ldmx;
+
+/**
+ * The links of the particles and ECal sim hits of an event, as seen through
+ * the resolved pointers.
+ */
+struct EventLinks {
+    std::vector<int> daughters;
+    std::vector<int> parents;
+    std::vector<int> contribs;
+
+    bool operator==(const EventLinks& other) const {
+        return daughters == other.daughters && parents == other.parents && contribs == other.contribs;
+    }
+};
+
+EventLinks readLinks(EventImpl& event) {
+
+    EventLinks links;
+
+    const TClonesArray* particles = event.getCollection(EventConstants::SIM_PARTICLES);
+    for (int iParticle = 0; iParticle < particles->GetEntriesFast(); ++iParticle) {
+        const SimParticle* particle = static_cast<const SimParticle*>(particles->At(iParticle));
+        for (int iDaughter = 0; iDaughter < particle->getDaughterCount(); ++iDaughter) {
+            const SimParticle* daughter = particle->getDaughter(iDaughter);
+            links.daughters.push_back(daughter ? daughter->getTrackID() : -1);
+        }
+        for (int iParent = 0; iParent < particle->getParentCount(); ++iParent) {
+            const SimParticle* parent = particle->getParent(iParent);
+            links.parents.push_back(parent ? parent->getTrackID() : -1);
+        }
+    }
+
+    const TClonesArray* hits = event.getCollection(EventConstants::ECAL_SIM_HITS);
+    for (int iHit = 0; iHit < hits->GetEntriesFast(); ++iHit) {
+        SimCalorimeterHit* hit = static_cast<SimCalorimeterHit*>(hits->At(iHit));
+        for (unsigned iContrib = 0; iContrib < hit->getNumberOfContribs(); ++iContrib) {
+            SimCalorimeterHit::Contrib contrib = hit->getContrib(iContrib);
+            links.contribs.push_back(contrib.particle ? contrib.particle->getTrackID() : -1);
+        }
+    }
+
+    return links;
+}
+
+/** Write a few events with a primary, its daughters and hits from all of them. */
+void writeFile(const std::string& fileName, int nEvents) {
+
+    EventFile outFile(fileName, true);
+    EventImpl event("sim");
+    outFile.setupEvent(&event);
+
+    TClonesArray* particles = new TClonesArray(EventConstants::SIM_PARTICLE.c_str(), 10);
+    TClonesArray* hits = new TClonesArray(EventConstants::SIM_CALORIMETER_HIT.c_str(), 10);
+
+    for (int ievent = 0; ievent < nEvents; ++ievent) {
+
+        EventHeader& header = event.getEventHeaderMutable();
+        header.setEventNumber(ievent);
+
+        int nDaughters = 2 + ievent;
+        SimParticle* primary = (SimParticle*) particles->ConstructedAt(0);
+        primary->setTrackID(1);
+        primary->setPdgID(11);
+        for (int iDaughter = 0; iDaughter < nDaughters; ++iDaughter) {
+            SimParticle* daughter = (SimParticle*) particles->ConstructedAt(iDaughter + 1);
+            daughter->setTrackID(iDaughter + 2);
+            daughter->setPdgID(22);
+            primary->addDaughter(daughter);
+            daughter->addParent(primary);
+        }
+
+        for (int iHit = 0; iHit <= nDaughters; ++iHit) {
+            SimCalorimeterHit* hit = (SimCalorimeterHit*) hits->ConstructedAt(iHit);
+            hit->setID(iHit + 1);
+            hit->addContrib((SimParticle*) particles->At(iHit), 11, 1., 1.);
+        }
+
+        event.add(EventConstants::SIM_PARTICLES, particles);
+        event.add(EventConstants::ECAL_SIM_HITS, hits);
+        outFile.nextEvent();
+        event.Clear();
+        particles->Clear("C");
+        hits->Clear("C");
+    }
+
+    outFile.close();
+    delete particles;
+    delete hits;
+}
+
+/**
+ * Macro writing the same events as writeFile() with the TRef links and class
+ * versions of the releases before track ID links.  It runs in a separate ROOT
+ * process since the old classes have the names of the current ones.
+ */
+const char* LEGACY_MACRO = R"MACRO(
+#include "TClonesArray.h"
+#include "TFile.h"
+#include "TObject.h"
+#include "TRefArray.h"
+#include "TTimeStamp.h"
+#include "TTree.h"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ldmx {
+
+    class EventHeader : public TObject {
+        public:
+            int eventNumber_{-1};
+            int run_{-1};
+            TTimeStamp timestamp_{0, 0};
+            double weight_{1.0};
+            bool isRealData_{false};
+            std::map<std::string, int> intParameters_;
+            std::map<std::string, float> floatParameters_;
+            std::map<std::string, std::string> stringParameters_;
+            ClassDef(EventHeader, 1);
+    };
+
+    class SimParticle : public TObject {
+        public:
+            SimParticle() : daughters_(new TRefArray), parents_(new TRefArray) {}
+            ~SimParticle() { delete daughters_; delete parents_; }
+            void Clear(Option_t* = "") { TObject::Clear(); daughters_->Clear(); parents_->Clear(); }
+            double energy_{0};
+            int trackID_{-1};
+            int pdgID_{0};
+            int genStatus_{-1};
+            double time_{0};
+            double x_{0};
+            double y_{0};
+            double z_{0};
+            double endX_{0};
+            double endY_{0};
+            double endZ_{0};
+            double px_{0};
+            double py_{0};
+            double pz_{0};
+            double endpx_{0};
+            double endpy_{0};
+            double endpz_{0};
+            double mass_{0};
+            double charge_{0};
+            TRefArray* daughters_;
+            TRefArray* parents_;
+            int processType_{-1};
+            ClassDef(SimParticle, 5);
+    };
+
+    class SimCalorimeterHit : public TObject {
+        public:
+            SimCalorimeterHit() : simParticleContribs_(new TRefArray) {}
+            ~SimCalorimeterHit() { delete simParticleContribs_; }
+            void Clear(Option_t* = "") {
+                TObject::Clear();
+                simParticleContribs_->Clear();
+                pdgCodeContribs_.clear();
+                edepContribs_.clear();
+                timeContribs_.clear();
+                nContribs_ = 0;
+            }
+            int id_{0};
+            float edep_{0};
+            float x_{0};
+            float y_{0};
+            float z_{0};
+            float time_{0};
+            TRefArray* simParticleContribs_;
+            std::vector<int> pdgCodeContribs_;
+            std::vector<float> edepContribs_;
+            std::vector<float> timeContribs_;
+            unsigned nContribs_{0};
+            ClassDef(SimCalorimeterHit, 2);
+    };
+}
+
+void event_impl_legacy_file(const char* fileName, int nEvents) {
+
+    TFile file(fileName, "RECREATE");
+    TTree* tree = new TTree("LDMX_Events", "LDMX Events");
+
+    ldmx::EventHeader* header = new ldmx::EventHeader;
+    TClonesArray* particles = new TClonesArray("ldmx::SimParticle", 10);
+    TClonesArray* hits = new TClonesArray("ldmx::SimCalorimeterHit", 10);
+    tree->Branch("EventHeader", &header);
+    tree->Branch("SimParticles_sim", &particles, 100000, 3);
+    tree->Branch("EcalSimHits_sim", &hits, 100000, 3);
+
+    for (int ievent = 0; ievent < nEvents; ++ievent) {
+
+        particles->Clear("C");
+        hits->Clear("C");
+        header->eventNumber_ = ievent;
+
+        int nDaughters = 2 + ievent;
+        ldmx::SimParticle* primary = (ldmx::SimParticle*) particles->ConstructedAt(0);
+        primary->trackID_ = 1;
+        primary->pdgID_ = 11;
+        for (int iDaughter = 0; iDaughter < nDaughters; ++iDaughter) {
+            ldmx::SimParticle* daughter = (ldmx::SimParticle*) particles->ConstructedAt(iDaughter + 1);
+            daughter->trackID_ = iDaughter + 2;
+            daughter->pdgID_ = 22;
+            primary->daughters_->Add(daughter);
+            daughter->parents_->Add(primary);
+        }
+
+        for (int iHit = 0; iHit <= nDaughters; ++iHit) {
+            ldmx::SimCalorimeterHit* hit = (ldmx::SimCalorimeterHit*) hits->ConstructedAt(iHit);
+            hit->id_ = iHit + 1;
+            hit->simParticleContribs_->Add(particles->At(iHit));
+            hit->pdgCodeContribs_.push_back(11);
+            hit->edepContribs_.push_back(1.);
+            hit->timeContribs_.push_back(1.);
+            hit->nContribs_ = 1;
+        }
+
+        tree->Fill();
+    }
+
+    tree->Write();
+    file.Close();
+}
+)MACRO";
+
+/** Write a file with TRef links by running LEGACY_MACRO with ROOT. */
+void writeLegacyFile(const std::string& fileName, int nEvents) {
+
+    const std::string macroName = "event_impl_legacy_file.C";
+    std::ofstream macro(macroName);
+    macro << LEGACY_MACRO;
+    macro.close();
+
+    std::string command = "root -l -b -q '" + macroName + "(\"" + fileName + "\", " + std::to_string(nEvents) + ")'";
+    if (std::system(command.c_str()) != 0) {
+        throw std::runtime_error("Failed to write the legacy file with: " + command);
+    }
+}
+
+/** Copy every event of a file to a skim file without fetching any collection. */
+void skimFile(const std::string& inputName, const std::string& outputName) {
+
+    EventFile inFile(inputName);
+    EventFile outFile(outputName, &inFile);
+    EventImpl event("skim");
+    outFile.setupEvent(&event);
+
+    while (outFile.nextEvent(true)) {}
+
+    outFile.close();
+    inFile.close();
+}
+
+/**
+ * Read the links of every event twice and check that both reads agree.
+ * @return The links of each event.
+ */
+std::vector<EventLinks> checkRereads(const std::string& fileName) {
+
+    EventFile inFile(fileName);
+    EventImpl event("reread");
+    inFile.setupEvent(&event);
+
+    std::vector<EventLinks> links;
+    int nEvents = 0;
+    while (inFile.nextEvent(false)) {
+        EventLinks first = readLinks(event);
+        EventLinks second = readLinks(event);
+        if (!(first == second)) {
+            throw std::runtime_error("Links changed when the collections were read again in event "
+                    + std::to_string(nEvents) + " of " + fileName);
+        }
+        for (const std::vector<int>* ids : {&first.daughters, &first.parents, &first.contribs}) {
+            for (int id : *ids) {
+                if (id < 0) {
+                    throw std::runtime_error("Unresolved link in event " + std::to_string(nEvents) + " of " + fileName);
+                }
+            }
+        }
+        links.push_back(first);
+        ++nEvents;
+    }
+    inFile.close();
+
+    std::cout << "Read the links of " << nEvents << " events from " << fileName << " twice okay" << std::endl;
+    return links;
+}
+
+/** Check that the links read from a file are the expected ones. */
+void checkSame(const std::vector<EventLinks>& links, const std::vector<EventLinks>& expected, const std::string& what) {
+    if (links.size() != expected.size()) {
+        throw std::runtime_error(what + " has " + std::to_string(links.size()) + " events instead of "
+                + std::to_string(expected.size()));
+    }
+    for (std::size_t ievent = 0; ievent < links.size(); ++ievent) {
+        if (!(links[ievent] == expected[ievent])) {
+            throw std::runtime_error(what + " has different links in event " + std::to_string(ievent));
+        }
+    }
+    std::cout << what << " has the expected links" << std::endl;
+}
+
+/**
+ * Read the SimParticles and ECal sim hits twice per event and check that the
+ * links are the same both times.  The same events are also written with TRef
+ * links as by older releases, and the converted links are checked both when
+ * reading that file and in a skim of it in which no collection is fetched.
+ * Another file with TRef links can be given as an argument to check it too.
+ */
+int main(int argc, const char* argv[]) {
+
+    std::cout << "Hello EventImpl reread test!" << std::endl;
+
+    const int nEvents = 3;
+    const std::string fileName = "event_impl_reread_test.root";
+    writeFile(fileName, nEvents);
+    std::vector<EventLinks> expected = checkRereads(fileName);
+
+    const std::string legacyName = "event_impl_reread_legacy_test.root";
+    writeLegacyFile(legacyName, nEvents);
+    checkSame(checkRereads(legacyName), expected, "Legacy file");
+
+    const std::string skimName = "event_impl_reread_skim_test.root";
+    skimFile(legacyName, skimName);
+    checkSame(checkRereads(skimName), expected, "Skim of the legacy file");
+
+    if (argc > 1) {
+        checkRereads(argv[1]);
+    }
+
+    std::cout << "Bye EventImpl reread test!" << std::endl;
+}
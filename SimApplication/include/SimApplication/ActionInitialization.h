@@ -0,0 +1,43 @@
+/**
+ * @file ActionInitialization.h
+ * @brief Class which creates the user actions for each Geant4 thread
+ * @author Omar Moreno, SLAC National Accelerator Laboratory
+ */
+
+#ifndef SIMAPPLICATION_ACTIONINITIALIZATION_H_
+#define SIMAPPLICATION_ACTIONINITIALIZATION_H_
+
+//------------//
+//   Geant4   //
+//------------//
+#include "G4VUserActionInitialization.hh"
+
+namespace ldmx {
+
+    /**
+     * @class ActionInitialization
+     * @brief Creates the user actions when running with worker threads
+     *
+     * @note
+     * Each worker gets its own primary generator, user actions, plugin manager
+     * and ROOT persistency manager, all of which are configured by the 
+     * macro commands that the master broadcasts to the workers.  The master 
+     * only needs a run action to open and close the output file.
+     */
+    class ActionInitialization : public G4VUserActionInitialization {
+
+        public:
+
+            /**
+             * Create the user actions of a worker thread.
+             */
+            void Build() const;
+
+            /**
+             * Create the user actions of the master thread.
+             */
+            void BuildForMaster() const;
+    };
+}
+
+#endif // SIMAPPLICATION_ACTIONINITIALIZATION_H_
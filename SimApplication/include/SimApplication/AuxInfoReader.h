@@ -9,6 +9,11 @@
 
 // Geant4
 #include "G4GDMLParser.hh"
+#include "G4MagneticField.hh"
+
+// STL
+#include <utility>
+#include <vector>
 
 // LDMX
 #include "DetDescr/DetectorHeader.h"
@@ -47,10 +52,21 @@ namespace ldmx {
             void readGlobalAuxInfo();
 
             /**
-             * Assign auxiliary info to volumes such as sensitive detectors.
+             * Assign auxiliary info to volumes such as regions and visualization attributes.
              */
             void assignAuxInfoToVolumes();
 
+            /**
+             * Create the sensitive detectors and field managers and assign them
+             * to their logical volumes.
+             *
+             * @note
+             * Geant4 keeps sensitive detectors and field managers per thread, so
+             * this is called from the detector construction on every worker 
+             * (or once in sequential mode).
+             */
+            void constructSDandField();
+
             /**
              * Get the detector header that was created from the userinfo block.
              * @return The detector header.
@@ -119,6 +135,16 @@ namespace ldmx {
              * Detector header with name and version.
              */
             ldmx::DetectorHeader* detectorHeader_ {nullptr};
+
+            /**
+             * Names and aux info of the sensitive detectors defined in the userinfo block.
+             */
+            std::vector<std::pair<G4String, const G4GDMLAuxListType*>> sensDetDefs_;
+
+            /**
+             * The global field map, if one was defined.
+             */
+            G4MagneticField* globalField_ {nullptr};
     };
 
 }
@@ -13,6 +13,7 @@
 // LDMX
 #include "Event/Event.h"
 #include "SimApplication/G4CalorimeterHit.h"
+#include "SimApplication/HitPool.h"
 #include "DetDescr/DetectorID.h"
 
 using ldmx::DetectorID;
@@ -89,6 +90,11 @@ namespace ldmx {
              * The depth to the layer volume.
              */
             int layerDepth_ {2};
+
+            /**
+             * Number of hits to reserve in the collection of the next event.
+             */
+            HitCapacityHint capacityHint_;
     };
 
 }
@@ -57,6 +57,8 @@ namespace ldmx {
             G4VPhysicalVolume *Construct();
 
             /**
+             * Construct the sensitive detectors, fields and biasing operators.
+             * In multithreaded mode this is called on every worker thread.
              */
             void ConstructSDandField();
 
@@ -0,0 +1,97 @@
+/**
+ * @file EcalFastSimMessenger.h
+ * @brief Messenger used to configure the frozen shower fast simulation of the ECal
+ */
+
+#ifndef SIMAPPLICATION_ECALFASTSIMMESSENGER_H_
+#define SIMAPPLICATION_ECALFASTSIMMESSENGER_H_
+
+//------------//
+//   Geant4   //
+//------------//
+#include "G4UIcmdWithoutParameter.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UImessenger.hh"
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <string>
+
+namespace ldmx {
+
+    /**
+     * @class EcalFastSimMessenger
+     * @brief Macro commands for the frozen shower fast simulation of the ECal
+     *
+     * @note
+     * The settings are read when the physics list and the sensitive detectors
+     * are built so they must be given before <i>/run/initialize</i>.
+     */
+    class EcalFastSimMessenger : public G4UImessenger {
+
+        public:
+
+            /** Constructor */
+            EcalFastSimMessenger();
+
+            /** Destructor */
+            ~EcalFastSimMessenger();
+
+            /** Process the macro command. */
+            void SetNewValue(G4UIcommand* command, G4String newValues);
+
+            /** @return True if the fast simulation is enabled. */
+            static bool isEnabled() { return enabled_; }
+
+            /** @return The path to the frozen shower library. */
+            static const std::string& getLibrary() { return library_; }
+
+            /** @return The name of the logical volume enclosing the ECal. */
+            static const std::string& getEnvelope() { return envelope_; }
+
+            /** @return The minimum kinetic energy of particles replaced by showers. */
+            static double getMinEnergy() { return minEnergy_; }
+
+            /** @return The maximum kinetic energy of particles replaced by showers. */
+            static double getMaxEnergy() { return maxEnergy_; }
+
+        private:
+
+            /** Directory containing the ECal fast simulation commands. */
+            G4UIdirectory* fastSimDir_{new G4UIdirectory{"/ldmx/ecalFastSim/"}};
+
+            /** Command enabling the fast simulation. */
+            G4UIcmdWithoutParameter* enableCmd_{new G4UIcmdWithoutParameter{"/ldmx/ecalFastSim/enable", this}};
+
+            /** Command setting the frozen shower library file. */
+            G4UIcmdWithAString* libraryCmd_{new G4UIcmdWithAString{"/ldmx/ecalFastSim/library", this}};
+
+            /** Command setting the ECal envelope volume. */
+            G4UIcmdWithAString* envelopeCmd_{new G4UIcmdWithAString{"/ldmx/ecalFastSim/envelope", this}};
+
+            /** Command setting the minimum energy. */
+            G4UIcmdWithADoubleAndUnit* minEnergyCmd_{new G4UIcmdWithADoubleAndUnit{"/ldmx/ecalFastSim/minEnergy", this}};
+
+            /** Command setting the maximum energy. */
+            G4UIcmdWithADoubleAndUnit* maxEnergyCmd_{new G4UIcmdWithADoubleAndUnit{"/ldmx/ecalFastSim/maxEnergy", this}};
+
+            /** Flag indicating if the fast simulation is enabled. */
+            static bool enabled_;
+
+            /** Path to the frozen shower library. */
+            static std::string library_;
+
+            /** Name of the logical volume enclosing the ECal. */
+            static std::string envelope_;
+
+            /** Minimum kinetic energy of particles replaced by showers. */
+            static double minEnergy_;
+
+            /** Maximum kinetic energy of particles replaced by showers. */
+            static double maxEnergy_;
+    };
+}
+
+#endif
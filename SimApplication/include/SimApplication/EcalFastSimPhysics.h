@@ -0,0 +1,53 @@
+/**
+ * @file EcalFastSimPhysics.h
+ * @brief Class adding the fast simulation process used by the ECal frozen showers
+ */
+
+#ifndef SIMAPPLICATION_ECALFASTSIMPHYSICS_H_
+#define SIMAPPLICATION_ECALFASTSIMPHYSICS_H_
+
+//------------//
+//   Geant4   //
+//------------//
+#include "G4VPhysicsConstructor.hh"
+
+namespace ldmx {
+
+    /**
+     * @class EcalFastSimPhysics
+     * @brief Adds the fast simulation process to e+, e- and gammas
+     *
+     * @note
+     * The process hands the tracks to the fast simulation models attached to the
+     * regions they are in, such as the EcalFrozenShowerModel.
+     */
+    class EcalFastSimPhysics : public G4VPhysicsConstructor {
+
+        public:
+
+            /**
+             * Class constructor.
+             * @param name The name of the physics.
+             */
+            EcalFastSimPhysics(const G4String& name = "EcalFastSimPhysics");
+
+            /**
+             * Class destructor.
+             */
+            virtual ~EcalFastSimPhysics();
+
+            /**
+             * Construct particles (no-op).
+             */
+            void ConstructParticle() {
+            }
+
+            /**
+             * Construct the fast simulation processes.
+             */
+            void ConstructProcess();
+    };
+
+}
+
+#endif
@@ -0,0 +1,128 @@
+/**
+ * @file EcalFrozenShowerLibrary.h
+ * @brief Class holding pre-recorded ECal showers binned in energy and depth
+ */
+
+#ifndef SIMAPPLICATION_ECALFROZENSHOWERLIBRARY_H_
+#define SIMAPPLICATION_ECALFROZENSHOWERLIBRARY_H_
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ldmx {
+
+    /**
+     * @class EcalFrozenShowerLibrary
+     * @brief Pre-recorded ECal showers binned in particle type, energy and depth
+     *
+     * @note
+     * A library is a ROOT file written by <i>ldmx-frozen-showers</i>.  It contains the
+     * bin edges as the TVectorD objects <i>energyBins</i> [MeV] and <i>depthBins</i> [mm],
+     * and a tree with one entry per shower holding the PDG code, kinetic energy and
+     * depth of the particle that started it, plus the energy deposits in the sensitive
+     * volumes as spots relative to the starting point.  Showers are recorded along +z,
+     * and the depth is measured from the front face of the ECal envelope.
+     */
+    class EcalFrozenShowerLibrary {
+
+        public:
+
+            /**
+             * @struct Shower
+             * @brief The energy deposits of one recorded shower
+             */
+            struct Shower {
+
+                /** Kinetic energy of the particle that started the shower [MeV]. */
+                double energy{0};
+
+                /** Spot positions relative to the starting point [mm]. */
+                std::vector<float> x, y, z;
+
+                /** Spot energies [MeV]. */
+                std::vector<float> e;
+            };
+
+            /** Name of the shower tree. */
+            static const std::string TREE_NAME;
+
+            /** Name of the energy bin edges. */
+            static const std::string ENERGY_BINS_NAME;
+
+            /** Name of the depth bin edges. */
+            static const std::string DEPTH_BINS_NAME;
+
+            /**
+             * Load a library from a file.
+             * @param fileName The library file.
+             */
+            EcalFrozenShowerLibrary(const std::string& fileName);
+
+            /**
+             * Get the library of a file, which is loaded once and shared by all threads.
+             * @param fileName The library file.
+             * @return The library.
+             */
+            static const EcalFrozenShowerLibrary* getLibrary(const std::string& fileName);
+
+            /**
+             * Check if there are showers for a particle.
+             * @param pdgID The PDG code of the particle.
+             * @param energy The kinetic energy of the particle [MeV].
+             * @param depth The depth of the particle [mm].
+             * @return True if the bin of the particle has showers.
+             */
+            bool hasShowers(int pdgID, double energy, double depth) const {
+                return getShowers(pdgID, energy, depth) != nullptr;
+            }
+
+            /**
+             * Pick a random shower from the bin of a particle.
+             * @param pdgID The PDG code of the particle.
+             * @param energy The kinetic energy of the particle [MeV].
+             * @param depth The depth of the particle [mm].
+             * @return A shower or nullptr if the bin is empty.
+             */
+            const Shower* pickShower(int pdgID, double energy, double depth) const;
+
+            /** @return The total number of showers. */
+            int getNumberOfShowers() const { return nShowers_; }
+
+        private:
+
+            /**
+             * Find the bin of a value.
+             * @param edges The bin edges.
+             * @param value The value.
+             * @return The bin index or -1 if the value is out of range.
+             */
+            static int findBin(const std::vector<double>& edges, double value);
+
+            /**
+             * Get the showers in the bin of a particle.
+             * @return The showers or nullptr if there are none.
+             */
+            const std::vector<Shower>* getShowers(int pdgID, double energy, double depth) const;
+
+        private:
+
+            /** Energy bin edges [MeV]. */
+            std::vector<double> energyBins_;
+
+            /** Depth bin edges [mm]. */
+            std::vector<double> depthBins_;
+
+            /** Showers by PDG code, indexed by energy bin times number of depth bins plus depth bin. */
+            std::map<int, std::vector<std::vector<Shower>>> showers_;
+
+            /** The total number of showers. */
+            int nShowers_{0};
+    };
+
+}
+
+#endif
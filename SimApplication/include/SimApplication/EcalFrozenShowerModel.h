@@ -0,0 +1,110 @@
+/**
+ * @file EcalFrozenShowerModel.h
+ * @brief Fast simulation model replacing low energy EM showers in the ECal with frozen showers
+ */
+
+#ifndef SIMAPPLICATION_ECALFROZENSHOWERMODEL_H_
+#define SIMAPPLICATION_ECALFROZENSHOWERMODEL_H_
+
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "SimApplication/EcalFrozenShowerLibrary.h"
+
+//------------//
+//   Geant4   //
+//------------//
+#include "G4Navigator.hh"
+#include "G4TouchableHistory.hh"
+#include "G4VFastSimulationModel.hh"
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <string>
+
+namespace ldmx {
+
+    /**
+     * @class EcalFrozenShowerModel
+     * @brief Replaces e+, e- and gammas in the ECal by showers from a frozen shower library
+     *
+     * @note
+     * The model is attached to the region containing the ECal but only triggers inside
+     * the envelope volume of the ECal, for particles within the energy range of the model
+     * whose energy and depth bin has showers in the library.  The spots of the shower are
+     * rotated onto the particle direction with a random azimuthal angle, scaled to the
+     * particle energy and given to the EcalSD of the sensor they fall in.
+     */
+    class EcalFrozenShowerModel : public G4VFastSimulationModel {
+
+        public:
+
+            /**
+             * Class constructor.
+             * @param region The region the model is attached to.
+             * @param library The frozen shower library.
+             * @param envelope The name of the logical volume enclosing the ECal.
+             * @param minEnergy The minimum kinetic energy of replaced particles.
+             * @param maxEnergy The maximum kinetic energy of replaced particles.
+             */
+            EcalFrozenShowerModel(G4Region* region, const EcalFrozenShowerLibrary* library,
+                    const std::string& envelope, double minEnergy, double maxEnergy);
+
+            /**
+             * Class destructor.
+             */
+            virtual ~EcalFrozenShowerModel();
+
+            /**
+             * @return True for e+, e- and gammas.
+             */
+            G4bool IsApplicable(const G4ParticleDefinition& particle);
+
+            /**
+             * @return True if the track should be replaced by a frozen shower.
+             */
+            G4bool ModelTrigger(const G4FastTrack& fastTrack);
+
+            /**
+             * Deposit a frozen shower and kill the track.
+             */
+            void DoIt(const G4FastTrack& fastTrack, G4FastStep& fastStep);
+
+        private:
+
+            /**
+             * @return The depth of the track from the front face of the envelope [mm].
+             */
+            double getDepth(const G4FastTrack& fastTrack);
+
+        private:
+
+            /** The frozen shower library. */
+            const EcalFrozenShowerLibrary* library_;
+
+            /** The name of the logical volume enclosing the ECal. */
+            std::string envelope_;
+
+            /** The minimum kinetic energy of replaced particles. */
+            double minEnergy_;
+
+            /** The maximum kinetic energy of replaced particles. */
+            double maxEnergy_;
+
+            /** The envelope solid of the cached front face. */
+            const G4VSolid* envelopeSolid_{nullptr};
+
+            /** Local z of the front face of the envelope [mm]. */
+            double envelopeFront_{0};
+
+            /** Navigator used to locate the sensors of the spots. */
+            G4Navigator navigator_;
+
+            /** Touchable updated with the sensor of each spot. */
+            G4TouchableHistory touchable_;
+    };
+
+}
+
+#endif
@@ -80,6 +80,15 @@ namespace ldmx {
                 enableHitContribs_ = enableHitContribs;
             }
 
+            /**
+             * Get whether hit contributions are enabled for the output hits.  The
+             * SimParticle ECal hit flags are filled only in that case.
+             * @return True if hit contributions are enabled.
+             */
+            bool getEnableHitContribs() const {
+                return enableHitContribs_;
+            }
+
             /**
              * Set whether hit contributions should be compressed by particle and PDG code.
              * @param compressHitContribs True to compress hit contribution information.
@@ -19,6 +19,10 @@
 // Geant4
 #include "G4Polyhedra.hh"
 
+// STL
+#include <cstdint>
+#include <unordered_map>
+
 namespace ldmx {
 
     /**
@@ -50,6 +54,23 @@ namespace ldmx {
              */
             G4bool ProcessHits(G4Step* aStep, G4TouchableHistory* ROhist);
 
+            /**
+             * Initialize the sensitive detector at the start of an event.
+             * @param hcEvent The hits collections of the event.
+             */
+            void Initialize(G4HCofThisEvent* hcEvent);
+
+            /**
+             * Deposit energy from a parameterized shower.
+             * Spots from the same track in the same cell are summed into one hit.
+             * @param position The global position of the spot.
+             * @param edep The energy of the spot.
+             * @param time The global time of the spot.
+             * @param track The track which started the shower.
+             * @param touchable The sensor containing the spot.
+             */
+            void processSpot(const G4ThreeVector& position, G4double edep, G4double time, const G4Track* track, const G4VTouchable* touchable);
+
         private:
 
             /**
@@ -62,6 +83,24 @@ namespace ldmx {
              */
             G4ThreeVector getHitPosition(G4Step* aStep);
 
+            /**
+             * Return the hit position of a point in a sensor.
+             * X and Y are taken from the point.
+             * Z corresponds to the volume's center.
+             * @param position The global position of the point.
+             * @param touchable The sensor containing the point.
+             * @return The hit position.
+             */
+            G4ThreeVector getHitPosition(G4ThreeVector position, const G4VTouchable* touchable);
+
+            /**
+             * Compute the packed ID of a hit.
+             * @param hitPosition The hit position.
+             * @param touchable The sensor containing the hit.
+             * @return The packed hit ID.
+             */
+            int computeHitID(const G4ThreeVector& hitPosition, const G4VTouchable* touchable);
+
         private:
 
             /**
@@ -73,6 +112,11 @@ namespace ldmx {
              * Map of polygonal layers for getting Z positions.
              */
             std::map<G4VSolid*, G4Polyhedron*> polyMap_;
+
+            /**
+             * Index of the hit made from spots by packed hit ID and track ID.
+             */
+            std::unordered_map<uint64_t, int> spotHits_;
     };
 
 }
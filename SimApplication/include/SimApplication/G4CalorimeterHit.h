@@ -10,10 +10,10 @@
 // Geant4
 #include "G4VHit.hh"
 #include "G4THitsCollection.hh"
-#include "G4Allocator.hh"
 #include "G4ThreeVector.hh"
 
 // LDMX
+#include "SimApplication/HitPool.h"
 #include "Event/SimCalorimeterHit.h"
 
 namespace ldmx {
@@ -209,24 +209,23 @@ namespace ldmx {
     typedef G4THitsCollection<G4CalorimeterHit> G4CalorimeterHitsCollection;
 
     /**
-     * Memory allocator for objects of this class.
+     * Memory pool for objects of this class.
      */
-    extern G4Allocator<G4CalorimeterHit> G4CalorimeterHitAllocator;
+    extern G4ThreadLocal HitPool<G4CalorimeterHit>* G4CalorimeterHitPool;
 
     /**
      * Implementation of custom new operator.
      */
     inline void* G4CalorimeterHit::operator new(size_t) {
-        void* aHit;
-        aHit = (void*) G4CalorimeterHitAllocator.MallocSingle();
-        return aHit;
+        if (!G4CalorimeterHitPool) G4CalorimeterHitPool = new HitPool<G4CalorimeterHit>;
+        return G4CalorimeterHitPool->allocate();
     }
 
     /**
      * Implementation of custom delete operator.
      */
     inline void G4CalorimeterHit::operator delete(void *aHit) {
-        G4CalorimeterHitAllocator.FreeSingle((G4CalorimeterHit*) aHit);
+        G4CalorimeterHitPool->release(aHit);
     }
 
 }
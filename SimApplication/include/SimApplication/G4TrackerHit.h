@@ -10,10 +10,10 @@
 // Geant4
 #include "G4VHit.hh"
 #include "G4THitsCollection.hh"
-#include "G4Allocator.hh"
 #include "G4ThreeVector.hh"
 
 // LDMX
+#include "SimApplication/HitPool.h"
 #include "Event/SimTrackerHit.h"
 
 // STL
@@ -320,24 +320,23 @@ namespace ldmx {
     typedef G4THitsCollection<G4TrackerHit> G4TrackerHitsCollection;
 
     /**
-     * Memory allocator for objects of this class.
+     * Memory pool for objects of this class.
      */
-    extern G4Allocator<G4TrackerHit> G4TrackerHitAllocator;
+    extern G4ThreadLocal HitPool<G4TrackerHit>* G4TrackerHitPool;
 
     /**
      * Implementation of custom new operator.
      */
     inline void* G4TrackerHit::operator new(size_t) {
-        void* aHit;
-        aHit = (void*) G4TrackerHitAllocator.MallocSingle();
-        return aHit;
+        if (!G4TrackerHitPool) G4TrackerHitPool = new HitPool<G4TrackerHit>;
+        return G4TrackerHitPool->allocate();
     }
 
     /**
      * Implementation of custom delete operator.
      */
     inline void G4TrackerHit::operator delete(void *aHit) {
-        G4TrackerHitAllocator.FreeSingle((G4TrackerHit*) aHit);
+        G4TrackerHitPool->release(aHit);
     }
 
 }
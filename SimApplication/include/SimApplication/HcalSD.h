@@ -11,6 +11,14 @@
 #include "SimApplication/CalorimeterSD.h"
 #include "DetDescr/HcalID.h"
 
+// STL
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class G4VPhysicalVolume;
+class G4VTouchable;
+
 namespace ldmx {
 
     /**
@@ -18,9 +26,11 @@ namespace ldmx {
      * @brief HCal sensitive detector
      *
      * @note
-     * This class basically doesn't do anything right now.
-     *
-     * @todo Add actual custom hit processing for HCal detector.
+     * Steps are combined into one G4CalorimeterHit per scintillator strip during the event.
+     * Each strip hit holds the Birks-corrected energy sum, the earliest time and the
+     * energy-weighted position of its steps, and the track ID and PDG code of the first
+     * step which hit the strip.  The section and layer of a layer volume are decoded
+     * from its copy number once and cached by physical volume.
      */
     class HcalSD : public CalorimeterSD {
 
@@ -31,10 +41,71 @@ namespace ldmx {
             virtual ~HcalSD();
 
             G4bool ProcessHits(G4Step* aStep, G4TouchableHistory* ROhist);
-            
+
+            /**
+             * Initialize the hits collection and reset the strip table.
+             * @param hcEvent The hits collections of the event.
+             */
+            void Initialize(G4HCofThisEvent* hcEvent);
+
+            /**
+             * Assign the energy-weighted positions to the strip hits.
+             * @param hcEvent The hits collections of the event.
+             */
+            void EndOfEvent(G4HCofThisEvent* hcEvent);
+
+            /**
+             * Get the layer volume of a step.
+             * @param touchable The touchable of the step.
+             * @param layerDepth The depth of the layer volume counted from the world volume.
+             * @return The layer volume.
+             */
+            static const G4VPhysicalVolume* getLayerVolume(const G4VTouchable* touchable, int layerDepth);
+
+            /**
+             * Decode the section and layer from the copy number of a layer volume.
+             * @param copyNumber The copy number, which is 1000 * section + layer.
+             * @param[out] section The HCal section.
+             * @param[out] layer The layer number.
+             */
+            static void decodeLayer(int copyNumber, int& section, int& layer);
+
+        private:
+
+            /**
+             * Decoded information about a layer volume.
+             */
+            struct LayerInfo {
+
+                /** The HCal section. */
+                int section;
+
+                /** The layer number. */
+                int layer;
+
+                /** Index of the strip hits in the hits collection, -1 if no hit. */
+                std::vector<int> stripHits;
+            };
+
+            /**
+             * Get the cached section and layer of a layer volume.
+             * @param layerVolume The physical volume at the layer depth.
+             * @return The layer information.
+             */
+            LayerInfo& getLayerInfo(const G4VPhysicalVolume* layerVolume);
+
         private:
           double birksc1_;
-          double birksc2_;    
+          double birksc2_;
+
+          /** Decoded layer volumes. */
+          std::unordered_map<const G4VPhysicalVolume*, LayerInfo> layers_;
+
+          /** The strips which have a hit in the current event. */
+          std::vector<std::pair<LayerInfo*, int>> filledStrips_;
+
+          /** Sum of energy times position of each strip hit, parallel to the hits collection. */
+          std::vector<G4ThreeVector> weightedPositions_;
     };
 
 }
@@ -0,0 +1,153 @@
+/**
+ * @file HitPool.h
+ * @brief Pooled storage for the per-step hit objects created by sensitive detectors
+ */
+
+#ifndef SIMAPPLICATION_HITPOOL_H_
+#define SIMAPPLICATION_HITPOOL_H_
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace ldmx {
+
+    /**
+     * @class HitPool
+     * @brief Fixed-size slot allocator for hit objects
+     *
+     * @note
+     * Slots are handed out sequentially from chunks of <i>chunkSize</i> objects
+     * which are never returned to the system.  Releasing a slot only decrements
+     * the number of live objects; once every hit allocated from the pool has been
+     * released, which happens when Geant4 deletes the hits collections of an event,
+     * the whole pool is rewound at once and the next event reuses the same memory.
+     * If an event is kept (e.g. by the visualization) the pool simply keeps growing
+     * until its hits are released.
+     *
+     * One pool should exist per thread, in the same way as a G4Allocator.
+     */
+    template<class T>
+    class HitPool {
+
+        public:
+
+            /**
+             * Class constructor.
+             * @param chunkSize The number of objects in each allocated chunk.
+             */
+            HitPool(std::size_t chunkSize = 4096) : chunkSize_(chunkSize) {
+            }
+
+            /**
+             * Class destructor.
+             * Frees every chunk, so no object from this pool may be alive.
+             */
+            ~HitPool() {
+                for (char* chunk : chunks_) {
+                    ::operator delete(chunk);
+                }
+            }
+
+            HitPool(const HitPool&) = delete;
+
+            HitPool& operator=(const HitPool&) = delete;
+
+            /**
+             * Get storage for one object.
+             * @return Uninitialized storage for an object of type T.
+             */
+            void* allocate() {
+                if (next_ == chunks_.size() * chunkSize_) {
+                    chunks_.push_back(static_cast<char*>(::operator new(chunkSize_ * sizeof(T))));
+                }
+                void* slot = chunks_[next_ / chunkSize_] + (next_ % chunkSize_) * sizeof(T);
+                ++next_;
+                ++live_;
+                return slot;
+            }
+
+            /**
+             * Give back the storage of one object.
+             * The memory is only reused after all live objects have been released.
+             * @param slot The storage previously returned by allocate().
+             */
+            void release(void*) {
+                if (--live_ == 0) {
+                    next_ = 0;
+                }
+            }
+
+            /**
+             * Get the number of objects that have not been released.
+             * @return The number of live objects.
+             */
+            std::size_t getLiveCount() const {
+                return live_;
+            }
+
+            /**
+             * Get the number of objects that fit in the chunks allocated so far.
+             * @return The capacity of the pool.
+             */
+            std::size_t getCapacity() const {
+                return chunks_.size() * chunkSize_;
+            }
+
+        private:
+
+            /** The number of objects in each chunk. */
+            std::size_t chunkSize_;
+
+            /** The allocated chunks. */
+            std::vector<char*> chunks_;
+
+            /** Index of the next free slot. */
+            std::size_t next_{0};
+
+            /** The number of objects which have not been released. */
+            std::size_t live_{0};
+    };
+
+    /**
+     * @class HitCapacityHint
+     * @brief Running estimate of the number of hits a collection will receive
+     *
+     * @note
+     * The hint follows the largest recent hit count and decays by 1/8 per event,
+     * so that a hits collection can be reserved up front instead of being
+     * regrown step by step during the event.
+     */
+    class HitCapacityHint {
+
+        public:
+
+            /**
+             * Get the number of hits to reserve for the next event.
+             * @return The capacity hint.
+             */
+            std::size_t get() const {
+                return hint_;
+            }
+
+            /**
+             * Update the hint with the number of hits in the event that just ended.
+             * @param nHits The number of hits in the event.
+             */
+            void update(std::size_t nHits) {
+                hint_ = std::max(nHits, hint_ - hint_ / 8);
+            }
+
+        private:
+
+            /** The current capacity hint. */
+            std::size_t hint_{0};
+    };
+
+}
+
+#endif
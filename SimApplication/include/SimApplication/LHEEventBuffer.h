@@ -0,0 +1,120 @@
+/**
+ * @file LHEEventBuffer.h
+ * @brief Reusable column-wise storage for the records of one LHE event
+ */
+
+#ifndef SIMAPPLICATION_LHEEVENTBUFFER_H_
+#define SIMAPPLICATION_LHEEVENTBUFFER_H_
+
+// STL
+#include <cstddef>
+#include <vector>
+
+namespace ldmx {
+
+    /**
+     * @class LHEEventBuffer
+     * @brief Event information and particle records of one LHE event
+     *
+     * @note
+     * Particle records are stored as one array per field so that the buffer
+     * can be refilled event after event without allocating.  Field names
+     * follow the Les Houches Event (LHE) standard, and the mother indices
+     * are one-based as in the file, with 0 meaning no mother.
+     */
+    struct LHEEventBuffer {
+
+        /** Number of particles (NUP). */
+        int nup{0};
+
+        /** Physics process ID (IDPRUP). */
+        int idprup{0};
+
+        /** Event weight (XWGTUP). */
+        double xwgtup{0};
+
+        /** Scale Q of parton distributions (SCALUP). */
+        double scalup{0};
+
+        /** QED coupling value (AQEDUP). */
+        double aqedup{0};
+
+        /** QCD coupling value (AQCDUP). */
+        double aqcdup{0};
+
+        /** Vertex from the "#vertex" comment line, if any. */
+        double vertex[3]{0, 0, 0};
+
+        /** Particle PDG codes (IDUP). */
+        std::vector<int> idup;
+
+        /** Particle status codes (ISTUP). */
+        std::vector<int> istup;
+
+        /** First mother indices (MOTHUP[0]). */
+        std::vector<int> mothup1;
+
+        /** Second mother indices (MOTHUP[1]). */
+        std::vector<int> mothup2;
+
+        /** First color line tags (ICOLUP[0]). */
+        std::vector<int> icolup1;
+
+        /** Second color line tags (ICOLUP[1]). */
+        std::vector<int> icolup2;
+
+        /** Momentum X components [GeV] (PUP[0]). */
+        std::vector<double> px;
+
+        /** Momentum Y components [GeV] (PUP[1]). */
+        std::vector<double> py;
+
+        /** Momentum Z components [GeV] (PUP[2]). */
+        std::vector<double> pz;
+
+        /** Energies [GeV] (PUP[3]). */
+        std::vector<double> e;
+
+        /** Masses [GeV] (PUP[4]). */
+        std::vector<double> m;
+
+        /** Proper lifetimes [mm] (VTIMUP). */
+        std::vector<double> vtimup;
+
+        /** Spin values (SPINUP). */
+        std::vector<double> spinup;
+
+        /**
+         * Get the number of particle records.
+         * @return The number of particle records.
+         */
+        std::size_t size() const {
+            return idup.size();
+        }
+
+        /**
+         * Remove all records while keeping the allocated memory.
+         */
+        void clear() {
+            nup = idprup = 0;
+            xwgtup = scalup = aqedup = aqcdup = 0;
+            vertex[0] = vertex[1] = vertex[2] = 0;
+            idup.clear();
+            istup.clear();
+            mothup1.clear();
+            mothup2.clear();
+            icolup1.clear();
+            icolup2.clear();
+            px.clear();
+            py.clear();
+            pz.clear();
+            e.clear();
+            m.clear();
+            vtimup.clear();
+            spinup.clear();
+        }
+    };
+
+}
+
+#endif
@@ -9,16 +9,24 @@
 
 // Geant4
 #include "G4RunManager.hh"
+#include "G4PrimaryParticle.hh"
 #include "G4VPrimaryGenerator.hh"
 
 // LDMX
 #include "SimApplication/LHEReader.h"
 
+// STL
+#include <vector>
+
 namespace ldmx {
 
     /**
      * @class LHEPrimaryGenerator
-     * @brief Generates a Geant4 event from an LHEEvent
+     * @brief Generates a Geant4 event from LHE event data
+     *
+     * @note
+     * Event <i>firstEvent</i> + <i>n</i> of the file is used for Geant4 event <i>n</i>
+     * so that jobs can be sharded over one LHE file and worker threads stay in step.
      */
     class LHEPrimaryGenerator : public G4VPrimaryGenerator {
 
@@ -27,8 +35,9 @@ namespace ldmx {
             /**
              * Class constructor.
              * @param reader The LHE reader with the event data.
+             * @param firstEvent The index of the first event to read from the file.
              */
-            LHEPrimaryGenerator(LHEReader* reader);
+            LHEPrimaryGenerator(LHEReader* reader, int firstEvent = 0);
 
             /**
              * Class destructor.
@@ -47,6 +56,21 @@ namespace ldmx {
              * The LHE reader with the event data.
              */
             LHEReader* reader_;
+
+            /**
+             * The index of the first event to read from the file.
+             */
+            int firstEvent_{0};
+
+            /**
+             * Reused buffer for the current LHE event.
+             */
+            LHEEventBuffer buffer_;
+
+            /**
+             * The primaries created for each particle record in the current event.
+             */
+            std::vector<G4PrimaryParticle*> primaries_;
     };
 
 }
@@ -8,16 +8,31 @@
 #define SIMAPPLICATION_LHEREADER_H_
 
 // LDMX
-#include "SimApplication/LHEEvent.h"
+#include "SimApplication/LHEEventBuffer.h"
 
 // STL
-#include <fstream>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// zlib
+struct z_stream_s;
 
 namespace ldmx {
 
     /**
      * @class LHEReader
-     * @brief Reads LHE event data into an LHEEvent object
+     * @brief Reads LHE event data into an LHEEventBuffer
+     *
+     * @note
+     * The input file is memory mapped.  Gzip compressed files are detected from their
+     * magic bytes and are decompressed from the mapping as a stream into a window of
+     * bounded size, so only the text around the current event is held in memory.  On
+     * the first open the offsets of all <event> elements in the text are indexed and
+     * cached in a file next to the input named <i>fileName</i>.idx, so that any event can
+     * be reached with seek().  For a compressed file, reaching an event before the
+     * current window restarts the decompression from the start of the file.  The cache
+     * is rebuilt when the size or modification time of the input changes.
      */
     class LHEReader {
 
@@ -34,18 +49,122 @@ namespace ldmx {
              */
             virtual ~LHEReader();
 
+            LHEReader(const LHEReader&) = delete;
+
+            LHEReader& operator=(const LHEReader&) = delete;
+
+            /**
+             * Get the number of events in the file.
+             * @return The number of events.
+             */
+            int getNumberOfEvents() const {
+                return eventOffsets_.size();
+            }
+
+            /**
+             * Set the index of the event which will be read next.
+             * @param eventIndex The zero-based index of the event.
+             * @return True if the event exists in the file.
+             */
+            bool seek(int eventIndex);
+
             /**
              * Read the next event.
-             * @return The next LHE event.
+             * @param buffer The buffer which is cleared and filled with the event.
+             * @return False if there are no more events.
              */
-            LHEEvent* readNextEvent();
+            bool readNextEvent(LHEEventBuffer& buffer);
 
         private:
 
             /**
-             * The input file stream.
+             * Get the text starting at an offset.  For a compressed file, the text is
+             * decompressed into the window, which is grown if a single request does
+             * not fit into it.
+             * @param offset The offset from the start of the text.
+             * @param length The number of characters needed.
+             * @param available Set to the number of characters that can be read, which
+             * is only less than the length at the end of the text.
+             * @return The text at the offset.
+             */
+            const char* view(std::uint64_t offset, std::size_t length, std::size_t& available);
+
+            /**
+             * Restart the decompression from the start of the compressed file.
+             */
+            void restartStream();
+
+            /**
+             * Decompress the next part of the text.
+             * @param out The output buffer.
+             * @param space The size of the output buffer.
+             * @return The number of characters written, which is only less than the
+             * space at the end of the text.
+             */
+            std::size_t inflateInto(char* out, std::size_t space);
+
+            /**
+             * Find the offsets of all event elements in the data.
+             */
+            void buildIndex();
+
+            /**
+             * Read the event offsets from the index cache.
+             * @param indexFileName The name of the index cache.
+             * @return True if the cache exists and matches the input file.
              */
-            std::ifstream ifs_;
+            bool readIndex(const std::string& indexFileName);
+
+            /**
+             * Write the event offsets to the index cache.
+             * Failures are ignored, e.g. if the directory is not writable.
+             * @param indexFileName The name of the index cache.
+             */
+            void writeIndex(const std::string& indexFileName) const;
+
+        private:
+
+            /** The memory mapping of the input file. */
+            void* mapping_{nullptr};
+
+            /** The size of the input file. */
+            std::size_t fileSize_{0};
+
+            /** The modification time of the input file. */
+            std::int64_t fileTime_{0};
+
+            /** Start of the mapped text of an uncompressed input file. */
+            const char* begin_{nullptr};
+
+            /** The size of the text, only known for a compressed file once it was read to the end. */
+            std::uint64_t textSize_{0};
+
+            /** The decompression stream of a compressed input file, null otherwise. */
+            z_stream_s* stream_{nullptr};
+
+            /** Next compressed input which was not yet given to the stream. */
+            const char* compressedNext_{nullptr};
+
+            /** Amount of compressed input which was not yet given to the stream. */
+            std::size_t compressedRemaining_{0};
+
+            /** True once the stream has decompressed all of the text. */
+            bool streamEnd_{false};
+
+            /** The window of decompressed text. */
+            std::vector<char> window_;
+
+            /** Offset of the start of the window in the text. */
+            std::uint64_t windowBegin_{0};
+
+            /** Number of decompressed characters in the window. */
+            std::size_t windowSize_{0};
+
+            /** Offsets of the event elements from the start of the text. */
+            std::vector<std::uint64_t> eventOffsets_;
+
+            /** Index of the next event to read. */
+            std::size_t nextEvent_{0};
     };
 
 }
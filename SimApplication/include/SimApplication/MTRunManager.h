@@ -0,0 +1,110 @@
+/**
+ * @file MTRunManager.h
+ * @brief Class providing a multithreaded Geant4 run manager implementation.
+ * @author Omar Moreno, SLAC National Accelerator Laboratory
+ */
+
+#ifndef _SIMAPPLICATION_MTRUNMANAGER_H_
+#define _SIMAPPLICATION_MTRUNMANAGER_H_
+
+#ifdef G4MULTITHREADED
+
+//------------//
+//   Geant4   //
+//------------//
+#include "G4MTRunManager.hh"
+
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "Biasing/BiasingMessenger.h"
+
+namespace ldmx {
+
+    // Forward declare to avoid circular dependency in headers
+    class DetectorConstruction; 
+    class ParallelWorldMessenger; 
+    class PluginManager; 
+    class PluginMessenger; 
+
+    /**
+     * @class MTRunManager
+     * @brief Extension of the Geant4 multithreaded run manager
+     *
+     * @note
+     * The master thread owns the geometry, physics list and output file while
+     * the events are simulated on the worker threads.  The user actions of 
+     * each thread are created by the ActionInitialization.
+     */
+    class MTRunManager : public G4MTRunManager {
+
+        public:
+
+            /**
+             * Class constructor.
+             */
+            MTRunManager();
+
+            /**
+             * Class destructor.
+             */
+            virtual ~MTRunManager();
+
+            /**
+             * Initialize physics.
+             */
+            void InitializePhysics();
+
+            /**
+             * Perform application initialization.
+             */
+            void Initialize();
+
+            /**
+             * Get the user detector construction cast to a specific type.
+             * @return The user detector construction.
+             */
+            DetectorConstruction* getDetectorConstruction(); 
+
+            /** Enable a parallel world. */
+            void enableParallelWorld(bool isPWEnabled) { isPWEnabled_ = isPWEnabled; }
+
+            /** Set the path to the GDML description of the parallel world. */
+            void setParallelWorldPath(std::string parallelWorldPath) { 
+                parallelWorldPath_ = parallelWorldPath; 
+            }
+
+        private:
+
+            /** 
+             * Plugin messenger of the master, which accepts the plugin commands 
+             * before they are passed on to the workers. 
+             */
+            PluginMessenger* pluginMessenger_;
+
+            /** Biasing messenger. */
+            BiasingMessenger* biasingMessenger_ {new BiasingMessenger()};
+
+            /** Parallel world messenger. */
+            ParallelWorldMessenger* pwMessenger_{nullptr};
+
+            /**
+             * Manager of sim plugins on the master.
+             */
+            PluginManager* pluginManager_{nullptr};
+
+            /** 
+             * Flag indicating whether a parallel world should be 
+             * registered 
+             */
+            bool isPWEnabled_{false};
+
+            /** Path to GDML description of parallel world. */
+            std::string parallelWorldPath_{""};
+
+    }; // MTRunManager
+} // ldmx
+
+#endif // G4MULTITHREADED
+
+#endif // _SIMAPPLICATION_MTRUNMANAGER_H_
@@ -23,6 +23,7 @@ namespace ldmx {
 
     // Forward declare to avoid circular depedency in headers
     class RunManager;
+    class MTRunManager;
 
     class ParallelWorldMessenger : public G4UImessenger { 
         
@@ -31,6 +32,9 @@ namespace ldmx {
             /** Constructor */
             ParallelWorldMessenger(RunManager* runManager);
 
+            /** Constructor used with the multithreaded run manager. */
+            ParallelWorldMessenger(MTRunManager* mtRunManager);
+
             /** Destructor */
             ~ParallelWorldMessenger(); 
             
@@ -42,6 +46,12 @@ namespace ldmx {
             /** Run manager */
             RunManager* runManager_{nullptr};
 
+            /** Multithreaded run manager */
+            MTRunManager* mtRunManager_{nullptr};
+
+            /** Setup the commands. */
+            void setupCommands();
+
             /** Directory containing all of the parallel world commands. */
             G4UIdirectory* pwDir_{new G4UIdirectory{"/ldmx/pw/"}};
 
@@ -56,6 +56,13 @@ namespace ldmx {
                 return useRootSeed_;
             };
 
+            /**
+             * Get the file used to pass the event seeds read from a ROOT file
+             * to the random engine.  Each worker thread gets its own file.
+             * @return The name of the seed file.
+             */
+            static std::string getRootSeedFile();
+
         private:
 
             /**
@@ -90,6 +97,10 @@ namespace ldmx {
             G4UIcmdWithoutParameter* rootEcalSPCmd_ {new G4UIcmdWithoutParameter {"/ldmx/generators/root/mode/fromEcalSP", this}};
             G4UIcmdWithoutParameter* rootRegenCmd_ {new G4UIcmdWithoutParameter {"/ldmx/generators/root/mode/regenerate", this}};
 
+            /** Commands for the first tree entry and the entry stride used by the ROOT generator. */
+            G4UIcmdWithAString* rootFirstEntryCmd_ {new G4UIcmdWithAString {"/ldmx/generators/root/firstEntry", this}};
+            G4UIcmdWithAString* rootStrideCmd_ {new G4UIcmdWithAString {"/ldmx/generators/root/stride", this}};
+
             /** The command for using the multiparticle gun. */
             G4UIcmdWithoutParameter* enableMPGunCmd_ {new G4UIcmdWithoutParameter {"/ldmx/generators/mpgun/enable", this}};
             
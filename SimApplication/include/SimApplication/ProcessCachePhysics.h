@@ -0,0 +1,56 @@
+/**
+ * @file ProcessCachePhysics.h
+ * @brief Physics constructor that fills the process cache
+ * @author Omar Moreno, SLAC National Accelerator Laboratory
+ */
+
+#ifndef SIMAPPLICATION_PROCESSCACHEPHYSICS_H_
+#define SIMAPPLICATION_PROCESSCACHEPHYSICS_H_
+
+//------------//
+//   Geant4   //
+//------------//
+#include "G4VPhysicsConstructor.hh"
+
+namespace ldmx {
+
+    /**
+     * @class ProcessCachePhysics
+     * @brief Fills the ProcessCache once the processes are constructed
+     *
+     * @note
+     * This constructor doesn't add any physics.  It has to be registered
+     * last so that the processes of all other constructors, including the
+     * biasing wrappers, exist when the cache is filled.  Geant4 constructs
+     * the processes on every thread, so each thread fills its own cache.
+     */
+    class ProcessCachePhysics : public G4VPhysicsConstructor {
+
+        public:
+
+            /**
+             * Class constructor.
+             * @param name The name of the physics.
+             */
+            ProcessCachePhysics(const G4String& name = "ProcessCachePhysics");
+
+            /**
+             * Class destructor.
+             */
+            virtual ~ProcessCachePhysics();
+
+            /**
+             * Construct particles (no-op).
+             */
+            void ConstructParticle() {
+            }
+
+            /**
+             * Fill the process cache of this thread from the process table.
+             */
+            void ConstructProcess();
+    };
+
+}
+
+#endif
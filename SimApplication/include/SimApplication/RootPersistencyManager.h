@@ -22,6 +22,16 @@
 #include "SimApplication/G4TrackerHit.h"
 #include "SimApplication/SimParticleBuilder.h"
 
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 // Forward declarations
 class G4Run; 
 
@@ -47,6 +57,13 @@ namespace ldmx {
      * individual steps into cell energy depositions.  The tracker hit
      * collections of G4TrackerHit objects are translated directly into 
      * output SimTrackerHit collections.
+     *
+     * When running with worker threads, each worker has its own instance 
+     * which builds the output collections and hands them to the instance
+     * on the master thread.  The master owns the output file and writes the 
+     * events in order of their event ID, holding back any that arrive early.
+     * A worker that gets too far ahead of the next event to be written waits
+     * until that event has been written.
      */
     class RootPersistencyManager : public G4PersistencyManager {
 
@@ -54,6 +71,25 @@ namespace ldmx {
 
             typedef std::map<std::string, TClonesArray*> HitsCollectionMap;
 
+            /**
+             * @struct QueuedEvent
+             * @brief An event built on a worker thread that is waiting to be written 
+             */
+            struct QueuedEvent {
+
+                /** The event header. */
+                EventHeader header;
+
+                /** The output collections by name which own their objects. */
+                std::vector<std::pair<std::string, TClonesArray*>> collections;
+
+                ~QueuedEvent() {
+                    for (auto& coll : collections) {
+                        delete coll.second;
+                    }
+                }
+            };
+
             /**
              * Class constructor.
              * Installs the object as the global persistency manager.
@@ -64,6 +100,9 @@ namespace ldmx {
                 for (auto entry : outputHitsCollections_) {
                     delete entry.second;
                 }
+                for (auto entry : masterCollections_) {
+                    delete entry.second;
+                }
             }
 
             /**
@@ -81,6 +120,17 @@ namespace ldmx {
              */
             G4bool Store(const G4Event* anEvent);
 
+            /**
+             * Submit an event built on a worker thread.  This is called on the
+             * master instance and writes out any events that are now in order.
+             * If the event is at least the maximum number of pending events 
+             * ahead of the next one to be written, the calling worker waits 
+             * until enough earlier events have been written.
+             * @param eventID The Geant4 event ID.
+             * @param event The event or <i>nullptr</i> if it was aborted.
+             */
+            void submitEvent(int eventID, std::unique_ptr<QueuedEvent> event);
+
             /**
              * This gets called automatically at the end of the run and is used to write out the run header
              * and close the writer.
@@ -98,6 +148,7 @@ namespace ldmx {
 
             /** 
              * This is called "manually" in UserRunAction to open the ROOT writer for the run.
+             * Worker threads do not open a file and only set up their hits collections.
              */
             void Initialize();
 
@@ -134,6 +185,15 @@ namespace ldmx {
                 compressionLevel_ = compressionLevel;
             }
 
+            /**
+             * Set the maximum number of events which are held back waiting 
+             * for an earlier event when running with worker threads.
+             * @param maxPendingEvents The maximum number of pending events.
+             */
+            void setMaxPendingEvents(int maxPendingEvents) {
+                maxPendingEvents_ = maxPendingEvents;
+            }
+
             /** 
              * Drop the hits associated with the specified collection.
              *
@@ -174,6 +234,19 @@ namespace ldmx {
              */
             void writeHeader(const G4Event* anEvent, Event* outputEvent);
 
+            /**
+             * Move the collections of the current output event into a queued 
+             * event and submit it to the master.
+             * @param anEvent The Geant4 event.
+             */
+            void queueEvent(const G4Event* anEvent);
+
+            /**
+             * Write an event built on a worker thread into the output file.
+             * @param queued The queued event.
+             */
+            void writeQueuedEvent(QueuedEvent* queued);
+
             /**
              * Write header info into the output event from Geant4.
              * @param fileName The filename that stores temporary seeds.
@@ -277,6 +350,48 @@ namespace ldmx {
              */
             HitsCollectionMap outputHitsCollections_;
 
+            /**
+             * True if this instance belongs to a worker thread.
+             */
+            bool isWorker_{false};
+
+            /**
+             * The instance on the master thread which writes the output file.
+             */
+            static RootPersistencyManager* master_;
+
+            /**
+             * Guards the queue of events submitted by the workers.
+             */
+            std::mutex queueMutex_;
+
+            /**
+             * Signals the workers waiting to submit an event that the next
+             * event to be written has changed.
+             */
+            std::condition_variable queueCondition_;
+
+            /**
+             * The maximum number of events that can be ahead of the next event 
+             * to be written when they are submitted.
+             */
+            int maxPendingEvents_{100};
+
+            /**
+             * Events submitted by the workers that are waiting for an earlier event.
+             */
+            std::map<int, std::unique_ptr<QueuedEvent>> pending_;
+
+            /**
+             * The ID of the next event to be written.
+             */
+            int nextEventID_{0};
+
+            /**
+             * Collections used by the master to write out the queued events.
+             */
+            HitsCollectionMap masterCollections_;
+
     };
 
 }
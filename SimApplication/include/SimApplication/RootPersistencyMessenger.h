@@ -14,6 +14,7 @@
 
 // Forward declarations
 class G4UIcommand;
+class G4UIcmdWithAnInteger;
 
 namespace ldmx {
 
@@ -65,6 +66,9 @@ namespace ldmx {
 
             /** Command used to specify the ROOT file compression level. */
             G4UIcommand* comprCmd_{nullptr};
+
+            /** Command used to limit the number of events waiting to be written. */
+            G4UIcmdWithAnInteger* maxPendingCmd_{nullptr};
             
             /** 
              * Command used to enable/disable saving of the hit contributions
@@ -8,21 +8,30 @@
 #define SIMAPPLICATION_ROOTPRIMARYGENERATOR_H_
 
 // Geant4
+#include "G4PrimaryVertex.hh"
 #include "G4VPrimaryGenerator.hh"
 #include "TFile.h"
 #include "TTree.h"
 #include "TClonesArray.h"
 #include "TVector3.h"
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <unordered_map>
 
 #include "Event/EventHeader.h"
+#include "Event/SimParticleResolver.h"
 
 namespace ldmx {
 
     /**
      * @class RootPrimaryGenerator
-     * @brief Generates a Geant4 event from an LHEEvent
+     * @brief Generates a Geant4 event from the particles of a previously simulated ROOT file
+     *
+     * @note
+     * Only the branches needed by the run mode are enabled, and they are read through a
+     * TTreeCache.  Geant4 event <i>n</i> uses tree entry <i>firstEntry</i> + <i>n</i> * <i>stride</i>
+     * so that one input file can be split over several jobs.
      */
     class RootPrimaryGenerator : public G4VPrimaryGenerator {
 
@@ -43,7 +52,22 @@ namespace ldmx {
              * Specify the run mode
              * @param the mode index.
              */
-            void setRunMode(int curmode) { runMode_ = curmode; };
+            void setRunMode(int curmode) { 
+                runMode_ = curmode; 
+                setupBranches();
+            };
+
+            /**
+             * Set the tree entry used for the first event.
+             * @param firstEntry The first tree entry, which must not be negative.
+             */
+            void setFirstEntry(int firstEntry);
+
+            /**
+             * Set the number of tree entries between consecutive events.
+             * @param stride The entry stride, which must be at least 1.
+             */
+            void setStride(int stride);
 
             /**
              * Generate vertices in the Geant4 event.
@@ -51,6 +75,34 @@ namespace ldmx {
              */
             void GeneratePrimaryVertex(G4Event* anEvent);
 
+        private:
+
+            /**
+             * Quantized position used to find vertices shared by primaries.
+             */
+            struct VertexKey {
+                std::int64_t x, y, z;
+                bool operator==(const VertexKey& other) const {
+                    return x == other.x && y == other.y && z == other.z;
+                }
+            };
+
+            /**
+             * Hash of a quantized vertex position.
+             */
+            struct VertexKeyHash {
+                std::size_t operator()(const VertexKey& key) const {
+                    std::size_t h = std::hash<std::int64_t>()(key.x);
+                    h = h * 31 + std::hash<std::int64_t>()(key.y);
+                    return h * 31 + std::hash<std::int64_t>()(key.z);
+                }
+            };
+
+            /**
+             * Enable only the branches needed by the run mode and add them to the tree cache.
+             */
+            void setupBranches();
+
         private:
 
             /**
@@ -74,6 +126,11 @@ namespace ldmx {
             TClonesArray* simParticles_;
             TClonesArray* ecalSPParticles_;
 
+            /**
+             * Links the scoring plane hits to the sim particles
+             */
+            SimParticleResolver resolver_;
+
             /**
              * The event header
              */
@@ -94,6 +151,21 @@ namespace ldmx {
              */
             int runMode_;
 
+            /**
+             * The tree entry of the first event.
+             */
+            int firstEntry_{0};
+
+            /**
+             * The number of tree entries between consecutive events.
+             */
+            int stride_{1};
+
+            /**
+             * Primary vertices of the current event by quantized position.
+             */
+            std::unordered_map<VertexKey, G4PrimaryVertex*, VertexKeyHash> vertexMap_;
+
     };
 
 }
@@ -12,6 +12,7 @@
 //   Geant4   //
 //------------//
 #include "G4RunManager.hh"
+#include "G4VUserPhysicsList.hh"
 
 //-------------//
 //   ldmx-sw   //
@@ -68,6 +69,14 @@ namespace ldmx {
                 parallelWorldPath_ = parallelWorldPath; 
             }
 
+            /**
+             * Create the physics list including the LDMX specific physics.
+             * This is shared with the multithreaded run manager.
+             * @param isPWEnabled True if parallel world physics should be registered.
+             * @return The physics list.
+             */
+            static G4VUserPhysicsList* createPhysicsList(bool isPWEnabled);
+
         private:
 
             /** Plugin messenger. */
@@ -29,6 +29,7 @@
 #include "DetDescr/IDField.h"
 #include "Event/Event.h"
 #include "SimApplication/G4TrackerHit.h"
+#include "SimApplication/HitPool.h"
 
 namespace ldmx { 
 
@@ -82,6 +83,9 @@ namespace ldmx {
             /** The subdetector ID. */
             int subDetID_{0};
 
+            /** Number of hits to reserve in the collection of the next event. */
+            HitCapacityHint capacityHint_;
+
     }; // ScoringPlaneSD
 } // ldmx
 
@@ -9,6 +9,7 @@
 
 // Geant4
 #include "G4UImessenger.hh"
+#include "G4UIcmdWithoutParameter.hh"
 
 namespace ldmx {
 
@@ -17,7 +18,8 @@ namespace ldmx {
      * @brief Macro commands for the simulation application
      *
      * @brief
-     * Currently this just defines the base <i>/ldmx</i> macro directory.
+     * This defines the base <i>/ldmx</i> macro directory and application 
+     * level debugging options.
      */
     class SimApplicationMessenger : public G4UImessenger {
 
@@ -48,6 +50,11 @@ namespace ldmx {
              * Top-level LDMX directory.
              */
             G4UIdirectory* ldmxDir_;
+
+            /**
+             * Command to record every step of the trajectories.
+             */
+            G4UIcmdWithoutParameter* storeTrajectoryPointsCmd_;
     };
 
 }
@@ -13,6 +13,9 @@
 
 #include "SimApplication/Trajectory.h"
 
+// STL
+#include <unordered_map>
+
 namespace ldmx {
 
     /**
@@ -31,7 +34,7 @@ namespace ldmx {
             /**
              * Map of track ID to parent ID.
              */
-            typedef std::map<G4int, G4int> TrackIDMap;
+            typedef std::unordered_map<G4int, G4int> TrackIDMap;
 
             /**
              * Add a record in the map connecting a track ID to its parent ID.
@@ -85,11 +88,8 @@ namespace ldmx {
              * track ID is not assigned to a Trajectory.
              */
             inline Trajectory* getTrajectory(G4int trackID) {
-                if (hasTrajectory(trackID)) {
-                    return trajectoryMap_[trackID];
-                } else {
-                    return nullptr;
-                }
+                auto it = trajectoryMap_.find(trackID);
+                return it != trajectoryMap_.end() ? it->second : nullptr;
             }
 
             /**
@@ -14,6 +14,7 @@
 #include "Event/Event.h"
 #include "DetDescr/TrackerID.h"
 #include "SimApplication/G4TrackerHit.h"
+#include "SimApplication/HitPool.h"
 
 namespace ldmx {
 
@@ -85,6 +86,11 @@ namespace ldmx {
              * The detector ID.
              */
             DetectorID* detID_{new TrackerID};
+
+            /**
+             * Number of hits to reserve in the collection of the next event.
+             */
+            HitCapacityHint capacityHint_;
     };
 
 }
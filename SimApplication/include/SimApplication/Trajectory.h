@@ -10,10 +10,12 @@
 // Geant4
 #include "G4TrajectoryContainer.hh"
 #include "G4VTrajectory.hh"
+#include "G4VTrajectoryPoint.hh"
 #include "G4Allocator.hh"
 #include "G4Track.hh"
 
 // STL
+#include <unordered_map>
 #include <vector>
 #include <cmath>
 
@@ -21,6 +23,47 @@ typedef std::vector<G4VTrajectoryPoint*> TrajectoryPointContainer;
 
 namespace ldmx {
 
+    /**
+     * @class TrajectoryPoint
+     * @brief Trajectory point which only holds a position
+     *
+     * @note
+     * These are stored by value in the Trajectory for its vertex and end point.
+     */
+    class TrajectoryPoint : public G4VTrajectoryPoint {
+
+        public:
+
+            /**
+             * Class constructor.
+             * @param position The position of the point.
+             */
+            TrajectoryPoint(const G4ThreeVector& position = G4ThreeVector()) :
+                    position_(position) {
+            }
+
+            /**
+             * Get the position of the point [mm].
+             * @return The position of the point.
+             */
+            const G4ThreeVector GetPosition() const {
+                return position_;
+            }
+
+            /**
+             * Set the position of the point [mm].
+             * @param position The position of the point.
+             */
+            void setPosition(const G4ThreeVector& position) {
+                position_ = position;
+            }
+
+        private:
+
+            /** The position of the point. */
+            G4ThreeVector position_;
+    };
+
     /**
      * @class Trajectory
      * @brief Trajectory implementation for storing track info for persistence and visualization
@@ -28,13 +71,17 @@ namespace ldmx {
      * @note
      * Class is based on this Geant4 tip:
      * <a href="http://geant4.slac.stanford.edu/Tips/event/3.html">Trajectory Event Tip</a>
+     *
+     * Only the vertex and the end point of the track are kept, since these are all
+     * that is needed to build the output SimParticle.  A point for every step can be 
+     * recorded for debugging or visualization by calling setStoreAllPoints().
      */
     class Trajectory : public G4VTrajectory {
 
         public:
 
             /** Map of track ID to Trajectory objects. */
-            typedef std::map<int, Trajectory*> TrajectoryMap;
+            typedef std::unordered_map<int, Trajectory*> TrajectoryMap;
 
             /**
              * Class constructor.
@@ -163,12 +210,22 @@ namespace ldmx {
 
             /**
              * Find a Trajectory by its track ID within a G4TrajectoryContainer.
+             * A TrajectoryContainer is searched through its track ID index.
              * @param trajCont The G4TrajectoryContainer to search.
              * @param trackID The track ID.
              * @return The matching Trajectory or null if does not exist.
              */
             static Trajectory* findByTrackID(G4TrajectoryContainer* trajCont, int trackID);
 
+            /**
+             * Enable recording a point for every step of new trajectories.
+             * This is off by default and should only be used for debugging. 
+             * @param storeAllPoints True to record every step.
+             */
+            static void setStoreAllPoints(bool storeAllPoints) {
+                storeAllPoints_ = storeAllPoints;
+            }
+
             /**
              * Get the creator process type of this particle.
              * This corresponds to the value returned by <i>G4VProcess::GetProcessSubType()</i>
@@ -196,8 +253,23 @@ namespace ldmx {
 
         private:
 
-            /** The list of trajectory points. */
-            TrajectoryPointContainer* trajPoints_;
+            /** The vertex of the trajectory. */
+            TrajectoryPoint vertexPoint_;
+
+            /** The last recorded position of the trajectory. */
+            TrajectoryPoint endPoint_;
+
+            /** True if a position after the vertex has been recorded. */
+            bool hasEndPoint_{false};
+
+            /** 
+             * The list of all trajectory points, which is only created when
+             * every step is being recorded. 
+             */
+            TrajectoryPointContainer* trajPoints_{nullptr};
+
+            /** Flag to record every step of new trajectories. */
+            static bool storeAllPoints_;
 
             /** The particle definition. */
             G4ParticleDefinition* particleDef_;
@@ -236,16 +308,17 @@ namespace ldmx {
     /**
      * Custom memory allocator.
      */
-    extern G4Allocator<Trajectory> TrajectoryAllocator;
+    extern G4ThreadLocal G4Allocator<Trajectory>* TrajectoryAllocator;
 
     inline void* Trajectory::operator new(size_t) {
+        if (!TrajectoryAllocator) TrajectoryAllocator = new G4Allocator<Trajectory>;
         void* aTrajectory;
-        aTrajectory = (void*) TrajectoryAllocator.MallocSingle();
+        aTrajectory = (void*) TrajectoryAllocator->MallocSingle();
         return aTrajectory;
     }
 
     inline void Trajectory::operator delete(void* aTrajectory) {
-        TrajectoryAllocator.FreeSingle((Trajectory*) aTrajectory);
+        TrajectoryAllocator->FreeSingle((Trajectory*) aTrajectory);
     }
 
 }
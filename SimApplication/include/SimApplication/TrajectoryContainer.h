@@ -14,7 +14,7 @@
 #include "SimApplication/Trajectory.h"
 
 // STL
-#include <map>
+#include <unordered_map>
 
 namespace ldmx {
 
@@ -39,13 +39,22 @@ namespace ldmx {
             virtual ~TrajectoryContainer() {;}
 
             /**
-             * Find a trajectory by its track ID.
+             * Find a trajectory in this container by its track ID.
              * @return The trajectory or <i>nullptr</i> if it does not exist.
-             * @todo Speed this up by using a map instead of linear search.
              *
-             * @note Replaced by static method in Trajectory class for now.
+             * @note Trajectories are only ever appended to the container, so
+             * the trajectories inserted since the last search are added to
+             * the track ID index before looking it up.
              */
             Trajectory* findByTrackID(G4int);
+
+        private:
+
+            /** Index in the container of the first trajectory of each track ID. */
+            std::unordered_map<G4int, int> trackIndex_;
+
+            /** Number of trajectories in the track ID index. */
+            int indexedEntries_{0};
     };
 
 }
@@ -0,0 +1,76 @@
+#!/usr/bin/python
+
+# Compare the ECal sim hits of a full simulation file with those of a file
+# simulated with the frozen shower fast simulation (/ldmx/ecalFastSim/enable).
+#
+# Usage: frozen_shower_validation.py full_sim.root fast_sim.root [plots.root]
+#
+# The distributions of the cell energy, the total energy, the number of hit
+# cells and the energy per layer are written to the plots file and compared
+# with a Kolmogorov-Smirnov test.
+
+import sys
+
+import ROOT
+
+ROOT.gROOT.SetBatch(True)
+ROOT.gSystem.Load("libEvent")
+
+def fill(file_name, tag):
+
+    histos = {
+        "cellEnergy" : ROOT.TH1F("cellEnergy_" + tag, "Cell energy;E [MeV];Cells", 200, 0, 10),
+        "totalEnergy" : ROOT.TH1F("totalEnergy_" + tag, "Total energy;E [MeV];Events", 200, 0, 200),
+        "nCells" : ROOT.TH1F("nCells_" + tag, "Hit cells;Cells;Events", 200, 0, 400),
+        "layerEnergy" : ROOT.TH1F("layerEnergy_" + tag, "Energy per layer;Layer;E [MeV]", 40, 0, 40),
+    }
+
+    input_file = ROOT.TFile(file_name)
+    tree = input_file.Get("LDMX_Events")
+    hits = ROOT.TClonesArray("ldmx::SimCalorimeterHit")
+    tree.SetBranchAddress("EcalSimHits_sim", hits)
+
+    for entry in range(tree.GetEntries()):
+        tree.GetEntry(entry)
+        total = 0.
+        cells = {}
+        for hit in hits:
+            cells[hit.getID()] = cells.get(hit.getID(), 0.) + hit.getEdep()
+        for cell_id, energy in cells.items():
+            histos["cellEnergy"].Fill(energy)
+            histos["layerEnergy"].Fill((cell_id >> 4) & 0xFF, energy)
+            total += energy
+        histos["totalEnergy"].Fill(total)
+        histos["nCells"].Fill(len(cells))
+
+    for histo in histos.values():
+        histo.SetDirectory(0)
+    input_file.Close()
+    return histos
+
+def main():
+
+    if len(sys.argv) < 3:
+        print("Usage: frozen_shower_validation.py full_sim.root fast_sim.root [plots.root]")
+        return 1
+
+    full = fill(sys.argv[1], "full")
+    fast = fill(sys.argv[2], "fast")
+
+    output = ROOT.TFile(sys.argv[3] if len(sys.argv) > 3 else "frozen_shower_validation.root", "RECREATE")
+    for name in sorted(full):
+        canvas = ROOT.TCanvas(name, name)
+        full[name].SetLineColor(ROOT.kBlack)
+        fast[name].SetLineColor(ROOT.kRed)
+        full[name].DrawNormalized("hist")
+        fast[name].DrawNormalized("hist same")
+        canvas.Write()
+        full[name].Write()
+        fast[name].Write()
+        print("%-12s full mean %10.4f  fast mean %10.4f  KS probability %.4f" % (
+            name, full[name].GetMean(), fast[name].GetMean(), full[name].KolmogorovTest(fast[name])))
+    output.Close()
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,61 @@
+/**
+ * @file ActionInitialization.cxx
+ * @brief Class which creates the user actions for each Geant4 thread
+ * @author Omar Moreno, SLAC National Accelerator Laboratory
+ */
+
+#include "SimApplication/ActionInitialization.h"
+
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "SimApplication/PrimaryGeneratorAction.h"
+#include "SimApplication/PrimaryGeneratorMessenger.h"
+#include "SimApplication/RootPersistencyMessenger.h"
+#include "SimApplication/RootPersistencyManager.h" 
+#include "SimApplication/SteppingAction.h"
+#include "SimApplication/UserEventAction.h"
+#include "SimApplication/UserRunAction.h"
+#include "SimApplication/UserStackingAction.h"
+#include "SimApplication/UserTrackingAction.h"
+#include "SimPlugins/PluginManager.h"
+#include "SimPlugins/PluginMessenger.h"
+
+namespace ldmx {
+
+    void ActionInitialization::Build() const {
+
+        PluginManager* pluginManager = new PluginManager();
+        new PluginMessenger(pluginManager);
+
+        PrimaryGeneratorAction* primaryGeneratorAction = new PrimaryGeneratorAction;
+        SetUserAction(primaryGeneratorAction);
+        new PrimaryGeneratorMessenger(primaryGeneratorAction);
+
+        UserRunAction* runAction = new UserRunAction;
+        UserEventAction* eventAction = new UserEventAction;
+        UserTrackingAction* trackingAction = new UserTrackingAction;
+        SteppingAction* steppingAction = new SteppingAction;
+        UserStackingAction* stackingAction = new UserStackingAction;
+
+        runAction->setPluginManager(pluginManager);
+        eventAction->setPluginManager(pluginManager);
+        trackingAction->setPluginManager(pluginManager);
+        steppingAction->setPluginManager(pluginManager);
+        stackingAction->setPluginManager(pluginManager);
+        primaryGeneratorAction->setPluginManager(pluginManager);
+
+        SetUserAction(runAction);
+        SetUserAction(eventAction);
+        SetUserAction(trackingAction);
+        SetUserAction(steppingAction);
+        SetUserAction(stackingAction);
+
+        RootPersistencyManager* rootIO = new RootPersistencyManager();
+        new RootPersistencyMessenger(rootIO);
+    }
+
+    void ActionInitialization::BuildForMaster() const {
+        SetUserAction(new UserRunAction);
+    }
+}
@@ -51,7 +51,7 @@ namespace ldmx {
             G4String auxUnit = iaux->unit;
 
             if (auxType == "SensDet") {
-                createSensitiveDetector(auxVal, iaux->auxList);
+                sensDetDefs_.push_back({auxVal, iaux->auxList});
             } else if (auxType == "DetectorID") {
                 createDetectorID(auxVal, iaux->auxList);
             } else if (auxType == "MagneticField") {
@@ -159,6 +159,52 @@ namespace ldmx {
     }
 
     void AuxInfoReader::assignAuxInfoToVolumes() {
+        const G4LogicalVolumeStore* lvs = G4LogicalVolumeStore::GetInstance();
+        std::vector<G4LogicalVolume*>::const_iterator lvciter;
+        for (lvciter = lvs->begin(); lvciter != lvs->end(); lvciter++) {
+            G4GDMLAuxListType auxInfo = parser_->GetVolumeAuxiliaryInformation(*lvciter);
+            if (auxInfo.size() > 0) {
+
+                for (std::vector<G4GDMLAuxStructType>::const_iterator iaux = auxInfo.begin(); iaux != auxInfo.end(); iaux++) {
+
+                    G4String auxType = iaux->type;
+                    G4String auxVal = iaux->value;
+                    G4String auxUnit = iaux->unit;
+
+                    G4LogicalVolume* lv = (*lvciter);
+
+                    if (auxType == "Region") {
+                        G4String regionName = auxVal;
+                        G4Region* region = G4RegionStore::GetInstance()->GetRegion(regionName);
+                        if (region != NULL) {
+                            region->AddRootLogicalVolume(lv);
+                            std::cout << "Added volume " << lv->GetName() << " to region " << regionName << std::endl;
+                        } else {
+                            std::cerr << "Referenced region " << regionName << " was not found!" << std::endl;
+                            G4Exception("", "", FatalException, "The region was not found.  Is it defined in userinfo?");
+                        }
+                    } else if (auxType == "VisAttributes") {
+                        G4String visName = auxVal;
+                        G4VisAttributes* visAttributes = VisAttributesStore::getInstance()->getVisAttributes(visName);
+                        if (visAttributes != NULL) {
+                            lv->SetVisAttributes(visAttributes);
+                            std::cout << "Assigned VisAttributes " << visName << " to volume " << lv->GetName() << std::endl;
+                        } else {
+                            std::cerr << "Referenced VisAttributes " << visName << " was not found!" << std::endl;
+                            G4Exception("", "", FatalException, "The VisAttributes was not found.  Is it defined in userinfo?");
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void AuxInfoReader::constructSDandField() {
+
+        for (auto& sensDet : sensDetDefs_) {
+            createSensitiveDetector(sensDet.first, sensDet.second);
+        }
+
         const G4LogicalVolumeStore* lvs = G4LogicalVolumeStore::GetInstance();
         std::vector<G4LogicalVolume*>::const_iterator lvciter;
         for (lvciter = lvs->begin(); lvciter != lvs->end(); lvciter++) {
@@ -194,30 +240,20 @@ namespace ldmx {
                             std::cout << "Unknown MagneticField ref in volume's auxiliary info: " << magFieldName << std::endl;
                             G4Exception("", "", FatalException, "The MagneticField was not found.  Is it defined in userinfo?");
                         }
-                    } else if (auxType == "Region") {
-                        G4String regionName = auxVal;
-                        G4Region* region = G4RegionStore::GetInstance()->GetRegion(regionName);
-                        if (region != NULL) {
-                            region->AddRootLogicalVolume(lv);
-                            std::cout << "Added volume " << lv->GetName() << " to region " << regionName << std::endl;
-                        } else {
-                            std::cerr << "Referenced region " << regionName << " was not found!" << std::endl;
-                            G4Exception("", "", FatalException, "The region was not found.  Is it defined in userinfo?");
-                        }
-                    } else if (auxType == "VisAttributes") {
-                        G4String visName = auxVal;
-                        G4VisAttributes* visAttributes = VisAttributesStore::getInstance()->getVisAttributes(visName);
-                        if (visAttributes != NULL) {
-                            lv->SetVisAttributes(visAttributes);
-                            std::cout << "Assigned VisAttributes " << visName << " to volume " << lv->GetName() << std::endl;
-                        } else {
-                            std::cerr << "Referenced VisAttributes " << visName << " was not found!" << std::endl;
-                            G4Exception("", "", FatalException, "The VisAttributes was not found.  Is it defined in userinfo?");
-                        }
                     }
                 }
             }
         }
+
+        // Assign the field map as the global field of this thread.
+        if (globalField_) {
+            G4FieldManager* fieldMgr = G4TransportationManager::GetTransportationManager()->GetFieldManager();
+            if (fieldMgr->GetDetectorField() != nullptr) {
+                G4Exception("", "", FatalException, "Global mag field was already assigned.");
+            }
+            fieldMgr->SetDetectorField(globalField_);
+            fieldMgr->CreateChordFinder(globalField_);
+        }
     }
 
     void AuxInfoReader::createDetectorID(G4String idName, const G4GDMLAuxListType* auxInfoList) {
@@ -352,16 +388,12 @@ namespace ldmx {
                 G4Exception("", "", FatalException, "File info with field data was not provided.");
             }
 
-            // Create new 3D field map.
-            G4MagneticField* fieldMap = new MagneticFieldMap3D(fileName.c_str(), offsetX, offsetY, offsetZ);
-
-            // Assign field map as global field.
-            G4FieldManager* fieldMgr = G4TransportationManager::GetTransportationManager()->GetFieldManager();
-            if (fieldMgr->GetDetectorField() != nullptr) {
+            // Create new 3D field map which is assigned as the global field 
+            // when the fields are constructed.
+            if (globalField_ != nullptr) {
                 G4Exception("", "", FatalException, "Global mag field was already assigned.");
             }
-            fieldMgr->SetDetectorField(fieldMap);
-            fieldMgr->CreateChordFinder(fieldMap);
+            globalField_ = new MagneticFieldMap3D(fileName.c_str(), offsetX, offsetY, offsetZ);
 
         } else {
             std::cerr << "Unknown MagFieldType in auxiliary info: " << magFieldType << std::endl;
@@ -33,6 +33,7 @@ namespace ldmx {
 
         // Setup hits collection and the HC ID.
         hitsCollection_ = new G4CalorimeterHitsCollection(SensitiveDetectorName, collectionName[0]);
+        hitsCollection_->GetVector()->reserve(capacityHint_.get());
         G4int hcID = G4SDManager::GetSDMpointer()->GetCollectionID(collectionName[0]);
         hce->AddHitsCollection(hcID, hitsCollection_);
     }
@@ -98,6 +99,9 @@ namespace ldmx {
     }
 
     void CalorimeterSD::EndOfEvent(G4HCofThisEvent*) {
+
+        capacityHint_.update(hitsCollection_->entries());
+
         // Print number of hits.
         if (this->verboseLevel > 0) {
             std::cout << GetName() << " had " << hitsCollection_->entries() << " hits in event" << std::endl;
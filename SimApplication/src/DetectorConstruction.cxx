@@ -1,5 +1,12 @@
 #include "SimApplication/DetectorConstruction.h"
 
+// LDMX
+#include "SimApplication/EcalFastSimMessenger.h"
+#include "SimApplication/EcalFrozenShowerModel.h"
+
+// Geant4
+#include "G4RegionStore.hh"
+
 namespace ldmx {
 
     DetectorConstruction::DetectorConstruction(G4GDMLParser* theParser) :
@@ -18,6 +25,19 @@ namespace ldmx {
 
     void DetectorConstruction::ConstructSDandField() {
 
+        auxInfoReader_->constructSDandField();
+
+        if (EcalFastSimMessenger::isEnabled()) {
+            G4Region* region = G4RegionStore::GetInstance()->GetRegion("CalorimeterRegion");
+            if (!region) {
+                G4Exception("DetectorConstruction::ConstructSDandField", "", FatalException,
+                            "The ECal fast simulation needs the region CalorimeterRegion.");
+            }
+            new EcalFrozenShowerModel(region, EcalFrozenShowerLibrary::getLibrary(EcalFastSimMessenger::getLibrary()),
+                    EcalFastSimMessenger::getEnvelope(), EcalFastSimMessenger::getMinEnergy(),
+                    EcalFastSimMessenger::getMaxEnergy());
+        }
+
         if (BiasingMessenger::isBiasingEnabled()) {
 
             // Instantiate the biasing operator
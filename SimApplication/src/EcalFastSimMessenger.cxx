@@ -0,0 +1,71 @@
+/**
+ * @file EcalFastSimMessenger.cxx
+ * @brief Messenger used to configure the frozen shower fast simulation of the ECal
+ */
+
+#include "SimApplication/EcalFastSimMessenger.h"
+
+//------------//
+//   Geant4   //
+//------------//
+#include "G4SystemOfUnits.hh"
+
+namespace ldmx {
+
+    bool EcalFastSimMessenger::enabled_{false};
+
+    std::string EcalFastSimMessenger::library_{"ecal_frozen_showers.root"};
+
+    std::string EcalFastSimMessenger::envelope_{"em_calorimeters"};
+
+    double EcalFastSimMessenger::minEnergy_{0};
+
+    double EcalFastSimMessenger::maxEnergy_{100 * MeV};
+
+    EcalFastSimMessenger::EcalFastSimMessenger() {
+
+        fastSimDir_->SetGuidance("Frozen shower fast simulation of the ECal.");
+
+        enableCmd_->AvailableForStates(G4ApplicationState::G4State_PreInit);
+        enableCmd_->SetGuidance("Replace low energy EM showers in the ECal with frozen showers.");
+
+        libraryCmd_->AvailableForStates(G4ApplicationState::G4State_PreInit);
+        libraryCmd_->SetGuidance("Frozen shower library written by ldmx-frozen-showers.");
+
+        envelopeCmd_->AvailableForStates(G4ApplicationState::G4State_PreInit);
+        envelopeCmd_->SetGuidance("Name of the logical volume enclosing the ECal.");
+
+        minEnergyCmd_->AvailableForStates(G4ApplicationState::G4State_PreInit);
+        minEnergyCmd_->SetGuidance("Minimum kinetic energy of particles replaced by frozen showers.");
+        minEnergyCmd_->SetDefaultUnit("MeV");
+
+        maxEnergyCmd_->AvailableForStates(G4ApplicationState::G4State_PreInit);
+        maxEnergyCmd_->SetGuidance("Maximum kinetic energy of particles replaced by frozen showers.");
+        maxEnergyCmd_->SetDefaultUnit("MeV");
+
+        // This messenger only exists on the master thread.
+        enableCmd_->SetToBeBroadcasted(false);
+        libraryCmd_->SetToBeBroadcasted(false);
+        envelopeCmd_->SetToBeBroadcasted(false);
+        minEnergyCmd_->SetToBeBroadcasted(false);
+        maxEnergyCmd_->SetToBeBroadcasted(false);
+    }
+
+    EcalFastSimMessenger::~EcalFastSimMessenger() {
+        delete enableCmd_;
+        delete libraryCmd_;
+        delete envelopeCmd_;
+        delete minEnergyCmd_;
+        delete maxEnergyCmd_;
+        delete fastSimDir_;
+    }
+
+    void EcalFastSimMessenger::SetNewValue(G4UIcommand* command, G4String newValues) {
+        if (command == enableCmd_) enabled_ = true;
+        else if (command == libraryCmd_) library_ = newValues;
+        else if (command == envelopeCmd_) envelope_ = newValues;
+        else if (command == minEnergyCmd_) minEnergy_ = G4UIcmdWithADoubleAndUnit::GetNewDoubleValue(newValues);
+        else if (command == maxEnergyCmd_) maxEnergy_ = G4UIcmdWithADoubleAndUnit::GetNewDoubleValue(newValues);
+    }
+
+}
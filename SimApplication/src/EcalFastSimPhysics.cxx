@@ -0,0 +1,32 @@
+/**
+ * @file EcalFastSimPhysics.cxx
+ * @brief Class adding the fast simulation process used by the ECal frozen showers
+ */
+
+#include "SimApplication/EcalFastSimPhysics.h"
+
+//------------//
+//   Geant4   //
+//------------//
+#include "G4Electron.hh"
+#include "G4FastSimulationManagerProcess.hh"
+#include "G4Gamma.hh"
+#include "G4Positron.hh"
+#include "G4ProcessManager.hh"
+
+namespace ldmx {
+
+    EcalFastSimPhysics::EcalFastSimPhysics(const G4String& name) :
+            G4VPhysicsConstructor(name) {
+    }
+
+    EcalFastSimPhysics::~EcalFastSimPhysics() {
+    }
+
+    void EcalFastSimPhysics::ConstructProcess() {
+        G4ParticleDefinition* particles[] = {G4Electron::Definition(), G4Positron::Definition(), G4Gamma::Definition()};
+        for (G4ParticleDefinition* particle : particles) {
+            particle->GetProcessManager()->AddDiscreteProcess(new G4FastSimulationManagerProcess("ecalFastSim"));
+        }
+    }
+}
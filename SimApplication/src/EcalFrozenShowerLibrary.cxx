@@ -0,0 +1,135 @@
+/**
+ * @file EcalFrozenShowerLibrary.cxx
+ * @brief Class holding pre-recorded ECal showers binned in energy and depth
+ */
+
+#include "SimApplication/EcalFrozenShowerLibrary.h"
+
+//------------//
+//   Geant4   //
+//------------//
+#include "globals.hh"
+#include "Randomize.hh"
+
+//----------//
+//   ROOT   //
+//----------//
+#include "TFile.h"
+#include "TTree.h"
+#include "TVectorD.h"
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <mutex>
+
+namespace ldmx {
+
+    const std::string EcalFrozenShowerLibrary::TREE_NAME = "FrozenShowers";
+
+    const std::string EcalFrozenShowerLibrary::ENERGY_BINS_NAME = "energyBins";
+
+    const std::string EcalFrozenShowerLibrary::DEPTH_BINS_NAME = "depthBins";
+
+    EcalFrozenShowerLibrary::EcalFrozenShowerLibrary(const std::string& fileName) {
+
+        TFile file(fileName.c_str());
+        TTree* tree = (TTree*) file.Get(TREE_NAME.c_str());
+        TVectorD* energyBins = (TVectorD*) file.Get(ENERGY_BINS_NAME.c_str());
+        TVectorD* depthBins = (TVectorD*) file.Get(DEPTH_BINS_NAME.c_str());
+        if (file.IsZombie() || !tree || !energyBins || !depthBins) {
+            G4Exception("EcalFrozenShowerLibrary::EcalFrozenShowerLibrary", "FrozenShowerError", FatalException,
+                        ("Failed to read frozen shower library " + fileName).c_str());
+        }
+
+        energyBins_.assign(energyBins->GetMatrixArray(), energyBins->GetMatrixArray() + energyBins->GetNrows());
+        depthBins_.assign(depthBins->GetMatrixArray(), depthBins->GetMatrixArray() + depthBins->GetNrows());
+        std::size_t nBins = (energyBins_.size() - 1) * (depthBins_.size() - 1);
+
+        int pdgID;
+        double energy, depth;
+        std::vector<float>* x = nullptr;
+        std::vector<float>* y = nullptr;
+        std::vector<float>* z = nullptr;
+        std::vector<float>* e = nullptr;
+        tree->SetBranchAddress("pdg", &pdgID);
+        tree->SetBranchAddress("energy", &energy);
+        tree->SetBranchAddress("depth", &depth);
+        tree->SetBranchAddress("x", &x);
+        tree->SetBranchAddress("y", &y);
+        tree->SetBranchAddress("z", &z);
+        tree->SetBranchAddress("e", &e);
+
+        for (Long64_t entry = 0; entry < tree->GetEntries(); ++entry) {
+            tree->GetEntry(entry);
+            int energyBin = findBin(energyBins_, energy);
+            int depthBin = findBin(depthBins_, depth);
+            if (energyBin < 0 || depthBin < 0) {
+                continue;
+            }
+            std::vector<std::vector<Shower>>& bins = showers_[pdgID];
+            bins.resize(nBins);
+            std::vector<Shower>& showers = bins[energyBin * (depthBins_.size() - 1) + depthBin];
+            showers.emplace_back();
+            Shower& shower = showers.back();
+            shower.energy = energy;
+            shower.x = *x;
+            shower.y = *y;
+            shower.z = *z;
+            shower.e = *e;
+            ++nShowers_;
+        }
+
+        delete x;
+        delete y;
+        delete z;
+        delete e;
+
+        std::cout << "[ EcalFrozenShowerLibrary ] : Read " << nShowers_ << " showers from " << fileName << std::endl;
+    }
+
+    const EcalFrozenShowerLibrary* EcalFrozenShowerLibrary::getLibrary(const std::string& fileName) {
+        static std::mutex libraryMutex;
+        static std::map<std::string, std::unique_ptr<EcalFrozenShowerLibrary>> libraries;
+        std::lock_guard<std::mutex> lock(libraryMutex);
+        std::unique_ptr<EcalFrozenShowerLibrary>& library = libraries[fileName];
+        if (!library) {
+            library.reset(new EcalFrozenShowerLibrary(fileName));
+        }
+        return library.get();
+    }
+
+    const EcalFrozenShowerLibrary::Shower* EcalFrozenShowerLibrary::pickShower(int pdgID, double energy, double depth) const {
+        const std::vector<Shower>* showers = getShowers(pdgID, energy, depth);
+        if (!showers) {
+            return nullptr;
+        }
+        std::size_t index = std::min<std::size_t>(G4UniformRand() * showers->size(), showers->size() - 1);
+        return &(*showers)[index];
+    }
+
+    int EcalFrozenShowerLibrary::findBin(const std::vector<double>& edges, double value) {
+        if (edges.size() < 2 || value < edges.front() || value >= edges.back()) {
+            return -1;
+        }
+        return std::upper_bound(edges.begin(), edges.end(), value) - edges.begin() - 1;
+    }
+
+    const std::vector<EcalFrozenShowerLibrary::Shower>* EcalFrozenShowerLibrary::getShowers(int pdgID, double energy, double depth) const {
+        auto it = showers_.find(pdgID);
+        if (it == showers_.end()) {
+            return nullptr;
+        }
+        int energyBin = findBin(energyBins_, energy);
+        int depthBin = findBin(depthBins_, depth);
+        if (energyBin < 0 || depthBin < 0) {
+            return nullptr;
+        }
+        const std::vector<Shower>& showers = it->second[energyBin * (depthBins_.size() - 1) + depthBin];
+        return showers.empty() ? nullptr : &showers;
+    }
+
+}
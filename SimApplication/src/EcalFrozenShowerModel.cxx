@@ -0,0 +1,105 @@
+/**
+ * @file EcalFrozenShowerModel.cxx
+ * @brief Fast simulation model replacing low energy EM showers in the ECal with frozen showers
+ */
+
+#include "SimApplication/EcalFrozenShowerModel.h"
+
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "SimApplication/EcalSD.h"
+
+//------------//
+//   Geant4   //
+//------------//
+#include "G4Electron.hh"
+#include "G4Gamma.hh"
+#include "G4Positron.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4TransportationManager.hh"
+#include "G4VSolid.hh"
+#include "Randomize.hh"
+
+namespace ldmx {
+
+    EcalFrozenShowerModel::EcalFrozenShowerModel(G4Region* region, const EcalFrozenShowerLibrary* library,
+            const std::string& envelope, double minEnergy, double maxEnergy) :
+            G4VFastSimulationModel("EcalFrozenShowerModel", region),
+            library_(library), envelope_(envelope), minEnergy_(minEnergy), maxEnergy_(maxEnergy) {
+    }
+
+    EcalFrozenShowerModel::~EcalFrozenShowerModel() {
+    }
+
+    G4bool EcalFrozenShowerModel::IsApplicable(const G4ParticleDefinition& particle) {
+        return &particle == G4Electron::Definition()
+                || &particle == G4Positron::Definition()
+                || &particle == G4Gamma::Definition();
+    }
+
+    G4bool EcalFrozenShowerModel::ModelTrigger(const G4FastTrack& fastTrack) {
+        if (fastTrack.GetEnvelopeLogicalVolume()->GetName() != envelope_) {
+            return false;
+        }
+        const G4Track* track = fastTrack.GetPrimaryTrack();
+        double energy = track->GetKineticEnergy();
+        if (energy < minEnergy_ || energy >= maxEnergy_) {
+            return false;
+        }
+        return library_->hasShowers(track->GetDefinition()->GetPDGEncoding(), energy, getDepth(fastTrack));
+    }
+
+    void EcalFrozenShowerModel::DoIt(const G4FastTrack& fastTrack, G4FastStep& fastStep) {
+
+        const G4Track* track = fastTrack.GetPrimaryTrack();
+        double energy = track->GetKineticEnergy();
+        const EcalFrozenShowerLibrary::Shower* shower = library_->pickShower(
+                track->GetDefinition()->GetPDGEncoding(), energy, getDepth(fastTrack));
+
+        // The world is only known once the geometry is closed.
+        if (!navigator_.GetWorldVolume()) {
+            navigator_.SetWorldVolume(G4TransportationManager::GetTransportationManager()->GetNavigatorForTracking()->GetWorldVolume());
+        }
+
+        G4ThreeVector localPosition = fastTrack.GetPrimaryTrackLocalPosition();
+        G4ThreeVector localDirection = fastTrack.GetPrimaryTrackLocalDirection();
+        const G4AffineTransform* toGlobal = fastTrack.GetInverseAffineTransformation();
+        double phi = twopi * G4UniformRand();
+        double scale = energy / shower->energy;
+
+        for (std::size_t iSpot = 0; iSpot < shower->e.size(); ++iSpot) {
+
+            G4ThreeVector spot(shower->x[iSpot], shower->y[iSpot], shower->z[iSpot]);
+            spot.rotateZ(phi);
+            spot.rotateUz(localDirection);
+            G4ThreeVector position = toGlobal->TransformPoint(localPosition + spot);
+
+            navigator_.LocateGlobalPointAndUpdateTouchable(position, &touchable_, false);
+            G4VPhysicalVolume* volume = touchable_.GetVolume();
+            if (!volume) {
+                continue;
+            }
+            EcalSD* sd = dynamic_cast<EcalSD*>(volume->GetLogicalVolume()->GetSensitiveDetector());
+            if (sd) {
+                sd->processSpot(position, scale * shower->e[iSpot],
+                        track->GetGlobalTime() + shower->z[iSpot] / c_light, track, &touchable_);
+            }
+        }
+
+        // The shower energy is given to the sensors directly, so no deposit is
+        // proposed for the step which would be seen by the current volume.
+        fastStep.KillPrimaryTrack();
+        fastStep.ProposePrimaryTrackPathLength(0.0);
+    }
+
+    double EcalFrozenShowerModel::getDepth(const G4FastTrack& fastTrack) {
+        const G4VSolid* solid = fastTrack.GetEnvelopeSolid();
+        if (solid != envelopeSolid_) {
+            envelopeSolid_ = solid;
+            envelopeFront_ = solid->GetExtent().GetZmin();
+        }
+        return fastTrack.GetPrimaryTrackLocalPosition().z() - envelopeFront_;
+    }
+
+}
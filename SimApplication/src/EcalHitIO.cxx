@@ -66,6 +66,11 @@ namespace ldmx {
                 // Find the SimParticle associated with this hit.
                 SimParticle* simParticle = simParticleBuilder_->findSimParticle(g4hit->getTrackID());
 
+                // Flag the particle so skims don't need to scan the contributions.
+                if (simParticle) {
+                    simParticle->setHasEcalHits(true);
+                }
+
                 // Find if there is an existing hit contrib.
                 int contribIndex = simHit->findContribIndex(simParticle, pdgCode);
 
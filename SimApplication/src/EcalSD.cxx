@@ -10,6 +10,8 @@
 #include "G4StepPoint.hh"
 #include "G4Geantino.hh"
 #include "G4ChargedGeantino.hh"
+#include "G4Track.hh"
+#include "G4VTouchable.hh"
 
 namespace ldmx {
 
@@ -54,17 +56,7 @@ namespace ldmx {
         hit->setTime(aStep->GetTrack()->GetGlobalTime());
 
         // Create the ID for the hit.
-	int cpynum = aStep->GetPreStepPoint()->GetTouchableHandle()->GetHistory()->GetVolume(layerDepth_)->GetCopyNo();
-	int layerNumber;
-	layerNumber = int(cpynum/7);
-	int module_position = cpynum%7;
-
-        int cellModuleID = hitMap_->getCellModuleID(hitPosition[0], hitPosition[1]);
-	int cellID = (hitMap_->separateID(cellModuleID)).first;
-        detID_->setFieldValue(1, layerNumber);
-        detID_->setFieldValue(2, module_position);
-	detID_->setFieldValue(3, cellID);
-        hit->setID(detID_->pack());
+        hit->setID(computeHitID(hitPosition, aStep->GetPreStepPoint()->GetTouchable()));
 
 	// Set the track ID on the hit.
         hit->setTrackID(aStep->GetTrack()->GetTrackID());
@@ -73,7 +65,7 @@ namespace ldmx {
         hit->setPdgCode(aStep->GetTrack()->GetParticleDefinition()->GetPDGEncoding());
 
         if (this->verboseLevel > 2) {
-	    std::cout << "Created new SimCalorimeterHit in detector " << this->GetName() << " with subdet ID " << subdet_ << " and layer " << layerNumber << " and cellid " << cellID << " module position " << module_position << " ...";
+	    std::cout << "Created new SimCalorimeterHit in detector " << this->GetName() << " with subdet ID " << subdet_ << " and layer " << detID_->getFieldValue(1) << " and cellid " << detID_->getFieldValue(3) << " module position " << detID_->getFieldValue(2) << " ...";
             hit->Print();
             std::cout << std::endl;
         }
@@ -84,6 +76,38 @@ namespace ldmx {
         return true;
     }
 
+    void EcalSD::Initialize(G4HCofThisEvent* hcEvent) {
+        CalorimeterSD::Initialize(hcEvent);
+        spotHits_.clear();
+    }
+
+    void EcalSD::processSpot(const G4ThreeVector& position, G4double edep, G4double time, const G4Track* track, const G4VTouchable* touchable) {
+
+        G4ThreeVector hitPosition = getHitPosition(position, touchable);
+        int id = computeHitID(hitPosition, touchable);
+
+        // Spots of the same shower falling in the same cell are summed into one hit.
+        uint64_t key = (uint64_t(uint32_t(id)) << 32) | uint32_t(track->GetTrackID());
+        auto it = spotHits_.find(key);
+        if (it != spotHits_.end()) {
+            G4CalorimeterHit* hit = (*hitsCollection_)[it->second];
+            hit->setEdep(hit->getEdep() + edep);
+            if (time < hit->getTime()) {
+                hit->setTime(time);
+            }
+            return;
+        }
+
+        G4CalorimeterHit* hit = new G4CalorimeterHit();
+        hit->setEdep(edep);
+        hit->setPosition(hitPosition.x(), hitPosition.y(), hitPosition.z());
+        hit->setTime(time);
+        hit->setID(id);
+        hit->setTrackID(track->GetTrackID());
+        hit->setPdgCode(track->GetParticleDefinition()->GetPDGEncoding());
+        spotHits_[key] = hitsCollection_->insert(hit) - 1;
+    }
+
     G4ThreeVector EcalSD::getHitPosition(G4Step* aStep) {
 
         /**
@@ -93,14 +117,19 @@ namespace ldmx {
         G4StepPoint* postPoint = aStep->GetPostStepPoint();
         G4ThreeVector position = 0.5 * (prePoint->GetPosition() + postPoint->GetPosition());
 
+        return getHitPosition(position, prePoint->GetTouchable());
+    }
+
+    G4ThreeVector EcalSD::getHitPosition(G4ThreeVector position, const G4VTouchable* touchable) {
+
         /*
          * Get the volume position in global coordinates, which for the ECal is the center of
          * the front face of the sensor.
          */
-        G4ThreeVector volumePosition = aStep->GetPreStepPoint()->GetTouchableHandle()->GetHistory()->GetTopTransform().Inverse().TransformPoint(G4ThreeVector());
+        G4ThreeVector volumePosition = touchable->GetHistory()->GetTopTransform().Inverse().TransformPoint(G4ThreeVector());
 
-        // Get the solid from this step.
-        G4VSolid* solid = prePoint->GetTouchableHandle()->GetVolume()->GetLogicalVolume()->GetSolid();
+        // Get the solid of the sensor.
+        G4VSolid* solid = touchable->GetVolume()->GetLogicalVolume()->GetSolid();
         auto it = polyMap_.find(solid);
         G4Polyhedron* poly;
         if (it == polyMap_.end()) {
@@ -124,4 +153,17 @@ namespace ldmx {
         return position;
     }
 
+    int EcalSD::computeHitID(const G4ThreeVector& hitPosition, const G4VTouchable* touchable) {
+	int cpynum = touchable->GetHistory()->GetVolume(layerDepth_)->GetCopyNo();
+	int layerNumber = int(cpynum/7);
+	int module_position = cpynum%7;
+
+        int cellModuleID = hitMap_->getCellModuleID(hitPosition[0], hitPosition[1]);
+	int cellID = (hitMap_->separateID(cellModuleID)).first;
+        detID_->setFieldValue(1, layerNumber);
+        detID_->setFieldValue(2, module_position);
+	detID_->setFieldValue(3, cellID);
+        return detID_->pack();
+    }
+
 }
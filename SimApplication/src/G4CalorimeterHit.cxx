@@ -8,7 +8,7 @@
 
 namespace ldmx {
 
-    G4Allocator<G4CalorimeterHit> G4CalorimeterHitAllocator;
+    G4ThreadLocal HitPool<G4CalorimeterHit>* G4CalorimeterHitPool = nullptr;
 
     void G4CalorimeterHit::Draw() {
 
@@ -8,7 +8,7 @@
 
 namespace ldmx {
 
-    G4Allocator<G4TrackerHit> G4TrackerHitAllocator;
+    G4ThreadLocal HitPool<G4TrackerHit>* G4TrackerHitPool = nullptr;
 
     void G4TrackerHit::Draw() {
 
@@ -12,6 +12,8 @@
 #include "G4ChargedGeantino.hh"
 #include "G4ParticleDefinition.hh"
 #include "G4ParticleTypes.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VTouchable.hh"
 
 namespace ldmx {
 
@@ -85,29 +87,21 @@ namespace ldmx {
         }
 
 
-        // Create a new cal hit.
-        G4CalorimeterHit* hit = new G4CalorimeterHit();
+        G4StepPoint* prePoint = aStep->GetPreStepPoint();
+        const G4VTouchable* touchable = prePoint->GetTouchable();
 
-        // Set the edep.
-        hit->setEdep(edep*birksFactor);
- 
         // Get the scintillator solid box
-        G4Box* scint = static_cast<G4Box*>(aStep->GetPreStepPoint()->GetTouchableHandle()->GetVolume()->GetLogicalVolume()->GetSolid());
+        G4Box* scint = static_cast<G4Box*>(touchable->GetSolid());
 
-        // Set the step mid-point as the hit position.
-        G4StepPoint* prePoint = aStep->GetPreStepPoint();
+        // Get the step mid-point in global and in local coordinates.
         G4StepPoint* postPoint = aStep->GetPostStepPoint();
         G4ThreeVector position = 0.5 * (prePoint->GetPosition() + postPoint->GetPosition());
-        G4ThreeVector localPosition = aStep->GetPreStepPoint()->GetTouchableHandle()->GetHistory()->GetTopTransform().TransformPoint(position);        
-        hit->setPosition(position[0], position[1], position[2]);
-        
-        // Set the global time.
-        hit->setTime(aStep->GetTrack()->GetGlobalTime());
+        G4ThreeVector localPosition = touchable->GetHistory()->GetTopTransform().TransformPoint(position);
 
-        // Create the ID for the hit.
-        int copyNum = aStep->GetPreStepPoint()->GetTouchableHandle()->GetHistory()->GetVolume(layerDepth_)->GetCopyNo();
-        int section = copyNum / 1000;
-        int layer = copyNum % 1000;
+        // Get the section and layer from the layer volume.
+        LayerInfo& layerInfo = getLayerInfo(getLayerVolume(touchable, layerDepth_));
+        int section = layerInfo.section;
+        int layer = layerInfo.layer;
 
         //stripID: back Hcal, segmented along y direction for now every 10 cm -- alternate x-y in the future?
         //         left/right side hcal: segmented along x direction every 10 cm
@@ -121,41 +115,108 @@ namespace ldmx {
         else if (section==HcalSection::BACK && layer % 2 == 0) stripID = int( (localPosition.x()+scint->GetXHalfLength())/50.0);
         else stripID = int( (localPosition.z()+scint->GetZHalfLength())/50.0);
 
-        // std::cout << "---" << std::endl;
-        // std::cout << "GetXHalfLength = " << scint->GetXHalfLength() << "\t GetYHalfLength = " << scint->GetYHalfLength() << "\t GetZHalfLength = " << scint->GetZHalfLength() << std::endl;
-        // std::cout << "xpos = " << localPosition.x() << "\t ypos = " << localPosition.y() << "\t zpos = " << localPosition.z() << std::endl;
-        // std::cout << "xpos_g = " << position.x() << "\t ypos_g = " << position.y() << "\t zpos_g = " << position.z() << std::endl;
-        // std::cout << "Layer = " << layer << "\t section = " << section << "\t strip = " << stripID << std::endl;
+        if (stripID >= (int) layerInfo.stripHits.size()) {
+            layerInfo.stripHits.resize(stripID + 1, -1);
+        }
+        int& hitIndex = layerInfo.stripHits[stripID];
+
+        G4double hitEdep = edep * birksFactor;
+        G4double time = aStep->GetTrack()->GetGlobalTime();
+
+        G4CalorimeterHit* hit = nullptr;
+        if (hitIndex < 0) {
+
+            // First step in this strip so create a new cal hit.
+            hit = new G4CalorimeterHit();
+
+            // The position is replaced by the energy-weighted one at the end of the event
+            // unless the strip has no energy (e.g. from Geantinos).
+            hit->setPosition(position[0], position[1], position[2]);
+            hit->setTime(time);
+
+            detID_->setFieldValue(1, layer);
+            detID_->setFieldValue(2, section);
+            detID_->setFieldValue(3, stripID);
+            hit->setID(detID_->pack());
 
-        detID_->setFieldValue(1, layer);
-        detID_->setFieldValue(2, section);
-        detID_->setFieldValue(3, stripID);
-        hit->setID(detID_->pack());
+            // Set the track ID on the hit.
+            hit->setTrackID(aStep->GetTrack()->GetTrackID());
 
-        // Set the track ID on the hit.
-        hit->setTrackID(aStep->GetTrack()->GetTrackID());
+            // Set the PDG code from the track.
+            hit->setPdgCode(aStep->GetTrack()->GetParticleDefinition()->GetPDGEncoding());
 
-        // Set the PDG code from the track.
-        hit->setPdgCode(aStep->GetTrack()->GetParticleDefinition()->GetPDGEncoding());
+            // Insert the hit into the hits collection.
+            hitIndex = hitsCollection_->insert(hit) - 1;
+            filledStrips_.emplace_back(&layerInfo, stripID);
+            weightedPositions_.emplace_back(0., 0., 0.);
 
-        //do we want to set the hit coordinate in the middle of the absorber?
-        // G4ThreeVector volumePosition = aStep->GetPreStepPoint()->GetTouchableHandle()->GetHistory()->GetTopTransform().Inverse().TransformPoint(G4ThreeVector());
-        // if (section==HcalSection::BACK) hit->setPosition(position[0], position[1], volumePosition.z());
-        // elseif (section==HcalSection::TOP || section==HcalSection::BOTTOM) hit->setPosition(position[0], volumePosition.y(), position[2]);
-        // elseif (section==HcalSection::LEFT || section==HcalSection::RIGHT) hit->setPosition(volumePosition.x(),position[1] , position[2]);        
+            if (this->verboseLevel > 2) {
+                std::cout << "Created new SimCalorimeterHit in detector " << this->GetName()
+                          << " subdet ID <" << subdet_ << ">, layer <" << layer << "> and section <" << section << ">, strip <" << stripID << ">"
+                          << std::endl;
+            }
+
+        } else {
+            hit = (*hitsCollection_)[hitIndex];
+            if (time < hit->getTime()) {
+                hit->setTime(time);
+            }
+        }
 
+        // Add the step to the strip.
+        hit->setEdep(hit->getEdep() + hitEdep);
+        weightedPositions_[hitIndex] += hitEdep * position;
 
         if (this->verboseLevel > 2) {
-            std::cout << "Created new SimCalorimeterHit in detector " << this->GetName()
-                      << " subdet ID <" << subdet_ << ">, layer <" << layer << "> and section <" << section << ">, copynum <" << copyNum << ">"
-                      << std::endl;
             hit->Print();
             std::cout << std::endl;
         }
 
-        // Insert the hit into the hits collection.
-        hitsCollection_->insert(hit);
-
         return true;
     }
+
+    void HcalSD::Initialize(G4HCofThisEvent* hce) {
+
+        CalorimeterSD::Initialize(hce);
+
+        // Reset only the strips which were filled in the last event.
+        for (auto& strip : filledStrips_) {
+            strip.first->stripHits[strip.second] = -1;
+        }
+        filledStrips_.clear();
+        weightedPositions_.clear();
+    }
+
+    void HcalSD::EndOfEvent(G4HCofThisEvent* hce) {
+
+        for (unsigned iHit = 0; iHit < weightedPositions_.size(); iHit++) {
+            G4CalorimeterHit* hit = (*hitsCollection_)[iHit];
+            if (hit->getEdep() > 0) {
+                G4ThreeVector position = weightedPositions_[iHit] / hit->getEdep();
+                hit->setPosition(position[0], position[1], position[2]);
+            }
+        }
+
+        CalorimeterSD::EndOfEvent(hce);
+    }
+
+    HcalSD::LayerInfo& HcalSD::getLayerInfo(const G4VPhysicalVolume* layerVolume) {
+        auto it = layers_.find(layerVolume);
+        if (it == layers_.end()) {
+            LayerInfo& layerInfo = layers_[layerVolume];
+            decodeLayer(layerVolume->GetCopyNo(), layerInfo.section, layerInfo.layer);
+            return layerInfo;
+        }
+        return it->second;
+    }
+
+    const G4VPhysicalVolume* HcalSD::getLayerVolume(const G4VTouchable* touchable, int layerDepth) {
+        // The layer depth counts from the world volume, so it is looked up in the history.
+        return touchable->GetHistory()->GetVolume(layerDepth);
+    }
+
+    void HcalSD::decodeLayer(int copyNumber, int& section, int& layer) {
+        section = copyNumber / 1000;
+        layer = copyNumber % 1000;
+    }
 }
@@ -3,6 +3,7 @@
 // Geant4
 #include "G4Event.hh"
 #include "G4IonTable.hh"
+#include "G4Threading.hh"
 
 // LDMX
 #include "SimApplication/UserPrimaryParticleInformation.h"
@@ -13,8 +14,9 @@
 
 namespace ldmx {
 
-    LHEPrimaryGenerator::LHEPrimaryGenerator(LHEReader* theReader) :
-            reader_(theReader) {
+    LHEPrimaryGenerator::LHEPrimaryGenerator(LHEReader* theReader, int firstEvent) :
+            reader_(theReader), firstEvent_(firstEvent) {
+        reader_->seek(firstEvent_);
     }
 
     LHEPrimaryGenerator::~LHEPrimaryGenerator() {
@@ -23,26 +25,26 @@ namespace ldmx {
 
     void LHEPrimaryGenerator::GeneratePrimaryVertex(G4Event* anEvent) {
 
-        LHEEvent* lheEvent = reader_->readNextEvent();
+        // Worker threads each have their own reader, so jump to the 
+        // record matching the ID of this event.
+        if (G4Threading::IsWorkerThread()) {
+            reader_->seek(firstEvent_ + anEvent->GetEventID());
+        }
 
-        if (lheEvent != NULL) {
+        if (reader_->readNextEvent(buffer_)) {
 
             G4PrimaryVertex* vertex = new G4PrimaryVertex();
-            vertex->SetPosition(lheEvent->getVertex()[0],lheEvent->getVertex()[1],lheEvent->getVertex()[2]);
-            vertex->SetWeight(lheEvent->getXWGTUP());
-
-            std::map<LHEParticle*, G4PrimaryParticle*> particleMap;
-
-            int particleIndex = 0;
-            const std::vector<LHEParticle*>& particles = lheEvent->getParticles();
-            for (std::vector<LHEParticle*>::const_iterator it = particles.begin(); it != particles.end(); it++) {
+            vertex->SetPosition(buffer_.vertex[0], buffer_.vertex[1], buffer_.vertex[2]);
+            vertex->SetWeight(buffer_.xwgtup);
 
-                LHEParticle* particle = (*it);
+            int nParticles = buffer_.size();
+            primaries_.assign(nParticles, nullptr);
+            for (int iParticle = 0; iParticle < nParticles; ++iParticle) {
 
-                if (particle->getISTUP() > 0) {
+                if (buffer_.istup[iParticle] > 0) {
 
                     G4PrimaryParticle* primary = new G4PrimaryParticle();
-                    if (particle->getIDUP() == -623) { /* Tungsten ion */
+                    if (buffer_.idup[iParticle] == -623) { /* Tungsten ion */
                         G4ParticleDefinition* tungstenIonDef = G4IonTable::GetIonTable()->GetIon(74, 184, 0.);
                         if (tungstenIonDef != NULL) {
                             primary->SetParticleDefinition(tungstenIonDef);
@@ -52,36 +54,34 @@ namespace ldmx {
                                         "Failed to find particle definition for W ion.");
                         }
                     } else {
-                        primary->SetPDGcode(particle->getIDUP());
+                        primary->SetPDGcode(buffer_.idup[iParticle]);
                     }
 
-                    primary->Set4Momentum(particle->getPUP(0) * GeV, 
-                                          particle->getPUP(1) * GeV, 
-                                          particle->getPUP(2) * GeV, 
-                                          particle->getPUP(3) * GeV);
-                    primary->SetProperTime(particle->getVTIMUP() * nanosecond);
+                    primary->Set4Momentum(buffer_.px[iParticle] * GeV, 
+                                          buffer_.py[iParticle] * GeV, 
+                                          buffer_.pz[iParticle] * GeV, 
+                                          buffer_.e[iParticle] * GeV);
+                    primary->SetProperTime(buffer_.vtimup[iParticle] * nanosecond);
 
                     UserPrimaryParticleInformation* primaryInfo = new UserPrimaryParticleInformation();
-                    primaryInfo->setHepEvtStatus(particle->getISTUP());
+                    primaryInfo->setHepEvtStatus(buffer_.istup[iParticle]);
                     primary->SetUserInformation(primaryInfo);
 
-                    particleMap[particle] = primary;
+                    primaries_[iParticle] = primary;
 
                     /*
                      * Assign primary as daughter but only if the mother is not a DOC particle.
                      */
-                    if (particle->getMother(0) != NULL && particle->getMother(0)->getISTUP() > 0) {
-                        G4PrimaryParticle* primaryMom = particleMap[particle->getMother(0)];
+                    int mother = buffer_.mothup1[iParticle] - 1;
+                    if (mother >= 0 && mother < nParticles && buffer_.istup[mother] > 0) {
+                        G4PrimaryParticle* primaryMom = primaries_[mother];
                         if (primaryMom != NULL) {
                             primaryMom->SetDaughter(primary);
                         }
                     } else {
                         vertex->SetPrimary(primary);
                     }
-
                 } 
-
-                ++particleIndex;
             }
 
             anEvent->AddPrimaryVertex(vertex);
@@ -91,8 +91,6 @@ namespace ldmx {
             G4RunManager::GetRunManager()->AbortRun(true);
             anEvent->SetEventAborted();
         }
-
-        delete lheEvent;
     }
 
 }
@@ -1,74 +1,504 @@
 #include "SimApplication/LHEReader.h"
 
+// Geant4
+#include "globals.hh"
+#include "G4Threading.hh"
+
 // STL
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
-#include <stdexcept>
+
+// POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// zlib
+#include <zlib.h>
+
+namespace {
+
+    /** Identifies an event index cache and its format version. */
+    const char INDEX_MAGIC[8] = {'L', 'H', 'E', 'I', 'D', 'X', '0', '2'};
+
+    /** Size of the window of decompressed text of a gzip compressed file. */
+    const std::size_t WINDOW_SIZE = 1 << 20;
+
+    /** Overlap between consecutive windows when indexing, the length of "<event" plus one. */
+    const std::size_t TAG_OVERLAP = 7;
+
+    /** Exactly representable powers of ten. */
+    const double POW10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    inline bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    inline bool isDigit(char c) {
+        return c >= '0' && c <= '9';
+    }
+
+    inline const char* skipSpace(const char* p, const char* end) {
+        while (p < end && isSpace(*p)) {
+            ++p;
+        }
+        return p;
+    }
+
+    inline const char* findLineEnd(const char* p, const char* end) {
+        const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+        return eol ? eol : end;
+    }
+
+    /**
+     * Parse an integer token, ignoring any fractional part like atoi does.
+     */
+    bool parseInt(const char*& p, const char* end, int& value) {
+        p = skipSpace(p, end);
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative = *p == '-';
+            ++p;
+        }
+        if (p == end || !isDigit(*p)) {
+            return false;
+        }
+        long result = 0;
+        while (p < end && isDigit(*p)) {
+            result = result * 10 + (*p - '0');
+            ++p;
+        }
+        while (p < end && !isSpace(*p) && *p != '\n') {
+            ++p;
+        }
+        value = negative ? -result : result;
+        return true;
+    }
+
+    /**
+     * Parse a floating point token.
+     *
+     * Mantissas of up to 15 significant digits with small exponents are converted
+     * exactly with a single multiplication or division by a power of ten.  Anything
+     * else, including Fortran style 'D' exponents with long mantissas, goes through strtod.
+     */
+    bool parseDouble(const char*& p, const char* end, double& value) {
+        p = skipSpace(p, end);
+        const char* start = p;
+
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative = *p == '-';
+            ++p;
+        }
+
+        std::uint64_t mantissa = 0;
+        int digits = 0;
+        int exponent = 0;
+        bool anyDigits = false;
+        while (p < end && isDigit(*p)) {
+            anyDigits = true;
+            if (digits < 19) {
+                if (mantissa != 0 || *p != '0') {
+                    ++digits;
+                }
+                mantissa = mantissa * 10 + (*p - '0');
+            } else {
+                ++exponent;
+                ++digits;
+            }
+            ++p;
+        }
+        if (p < end && *p == '.') {
+            ++p;
+            while (p < end && isDigit(*p)) {
+                anyDigits = true;
+                if (digits < 19) {
+                    if (mantissa != 0 || *p != '0') {
+                        ++digits;
+                    }
+                    mantissa = mantissa * 10 + (*p - '0');
+                    --exponent;
+                } else {
+                    ++digits;
+                }
+                ++p;
+            }
+        }
+        if (!anyDigits) {
+            return false;
+        }
+        if (p < end && (*p == 'e' || *p == 'E' || *p == 'd' || *p == 'D')) {
+            ++p;
+            int expValue = 0;
+            if (!parseInt(p, end, expValue)) {
+                return false;
+            }
+            exponent += expValue;
+        } else if (p < end && !isSpace(*p) && *p != '\n') {
+            return false;
+        }
+
+        if (digits <= 15 && exponent >= -22 && exponent <= 22) {
+            double result = static_cast<double>(mantissa);
+            result = exponent < 0 ? result / POW10[-exponent] : result * POW10[exponent];
+            value = negative ? -result : result;
+            return true;
+        }
+
+        // Slow path for long mantissas or large exponents.
+        std::string token(start, p);
+        for (char& c : token) {
+            if (c == 'd' || c == 'D') {
+                c = 'e';
+            }
+        }
+        value = std::strtod(token.c_str(), nullptr);
+        return true;
+    }
+
+    void badRecord(const char* lineStart, const char* lineEnd, const char* what) {
+        std::cerr << "ERROR: Bad " << what << " in LHE file ..." << std::endl;
+        std::cerr << "  " << std::string(lineStart, lineEnd) << std::endl;
+        G4Exception("LHEReader::readNextEvent", "LHEReaderError", FatalException,
+                    ("Wrong number of tokens or format in LHE " + std::string(what) + ".").c_str());
+    }
+}
 
 namespace ldmx {
 
     LHEReader::LHEReader(std::string& filename) {
         std::cout << "Opening LHE file " << filename << std::endl;
-        ifs_.open(filename.c_str(), std::ifstream::in);
+
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            G4Exception("LHEReader::LHEReader", "LHEReaderError", FatalException,
+                        ("Failed to open LHE file " + filename).c_str());
+        }
+
+        struct stat fileStat;
+        fstat(fd, &fileStat);
+        fileSize_ = fileStat.st_size;
+        fileTime_ = fileStat.st_mtime;
+
+        if (fileSize_ > 0) {
+            mapping_ = mmap(nullptr, fileSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping_ == MAP_FAILED) {
+                mapping_ = nullptr;
+                close(fd);
+                G4Exception("LHEReader::LHEReader", "LHEReaderError", FatalException,
+                            ("Failed to map LHE file " + filename).c_str());
+            }
+        }
+        close(fd);
+
+        const char* data = static_cast<const char*>(mapping_);
+        if (fileSize_ > 2 && (unsigned char) data[0] == 0x1f && (unsigned char) data[1] == 0x8b) {
+            stream_ = new z_stream;
+            memset(stream_, 0, sizeof(z_stream));
+
+            // Automatic gzip header detection.
+            if (inflateInit2(stream_, 16 + MAX_WBITS) != Z_OK) {
+                G4Exception("LHEReader::LHEReader", "LHEReaderError", FatalException, "Failed to initialize zlib.");
+            }
+            window_.resize(WINDOW_SIZE);
+            restartStream();
+        } else {
+            if (mapping_) {
+                madvise(mapping_, fileSize_, MADV_SEQUENTIAL);
+            }
+            begin_ = data;
+            textSize_ = fileSize_;
+        }
+
+        std::string indexFileName = filename + ".idx";
+        if (!readIndex(indexFileName)) {
+            buildIndex();
+            writeIndex(indexFileName);
+        }
+        std::cout << "LHE file has " << eventOffsets_.size() << " events" << std::endl;
     }
 
     LHEReader::~LHEReader() {
-        ifs_.close();
+        if (stream_) {
+            inflateEnd(stream_);
+            delete stream_;
+        }
+        if (mapping_) {
+            munmap(mapping_, fileSize_);
+        }
+    }
+
+    bool LHEReader::seek(int eventIndex) {
+        if (eventIndex < 0 || eventIndex >= (int) eventOffsets_.size()) {
+            nextEvent_ = eventOffsets_.size();
+            return false;
+        }
+        nextEvent_ = eventIndex;
+        return true;
     }
 
-    LHEEvent* LHEReader::readNextEvent() {
+    bool LHEReader::readNextEvent(LHEEventBuffer& buffer) {
 
-        std::string line;
-        bool foundEventElement = false;
-        while (getline(ifs_, line)) {
-            if (line == "<event>") {
-                foundEventElement = true;
+        if (nextEvent_ >= eventOffsets_.size()) {
+            std::cerr << "WARNING: No next <event> element was found by the LHE reader." << std::endl;
+            return false;
+        }
+
+        buffer.clear();
+
+        // The event ends before the next one, or with the text.
+        std::uint64_t offset = eventOffsets_[nextEvent_];
+        std::uint64_t nextOffset = nextEvent_ + 1 < eventOffsets_.size() ? eventOffsets_[nextEvent_ + 1] : textSize_;
+        std::size_t available;
+        const char* text = view(offset, nextOffset - offset, available);
+        const char* end = text + available;
+        ++nextEvent_;
+
+        // Skip the <event> line.
+        const char* p = findLineEnd(text, end);
+
+        // Event information record.
+        p = p < end ? p + 1 : p;
+        const char* eol = findLineEnd(p, end);
+        const char* lineStart = p;
+        if (!parseInt(p, eol, buffer.nup) || !parseInt(p, eol, buffer.idprup)
+                || !parseDouble(p, eol, buffer.xwgtup) || !parseDouble(p, eol, buffer.scalup)
+                || !parseDouble(p, eol, buffer.aqedup) || !parseDouble(p, eol, buffer.aqcdup)
+                || skipSpace(p, eol) != eol) {
+            badRecord(lineStart, eol, "event information record");
+        }
+
+        // Particle records and comments until the end of the event.
+        while (eol < end) {
+            p = eol + 1;
+            eol = findLineEnd(p, end);
+            lineStart = p;
+            p = skipSpace(p, eol);
+            if (p == eol) {
+                continue;
+            }
+            if (eol - p >= 8 && memcmp(p, "</event>", 8) == 0) {
                 break;
             }
+
+            const char* comment = static_cast<const char*>(memchr(p, '#', eol - p));
+            if (comment) {
+                if (eol - comment >= 7 && memcmp(comment, "#vertex", 7) == 0) {
+                    const char* v = comment + 7;
+                    if (!parseDouble(v, eol, buffer.vertex[0]) || !parseDouble(v, eol, buffer.vertex[1])
+                            || !parseDouble(v, eol, buffer.vertex[2]) || skipSpace(v, eol) != eol) {
+                        badRecord(lineStart, eol, "event vertex information record");
+                    }
+                }
+                continue;
+            }
+
+            int idup, istup, mothup1, mothup2, icolup1, icolup2;
+            double px, py, pz, e, m, vtimup, spinup;
+            if (!parseInt(p, eol, idup) || !parseInt(p, eol, istup)
+                    || !parseInt(p, eol, mothup1) || !parseInt(p, eol, mothup2)
+                    || !parseInt(p, eol, icolup1) || !parseInt(p, eol, icolup2)
+                    || !parseDouble(p, eol, px) || !parseDouble(p, eol, py) || !parseDouble(p, eol, pz)
+                    || !parseDouble(p, eol, e) || !parseDouble(p, eol, m)
+                    || !parseDouble(p, eol, vtimup) || !parseDouble(p, eol, spinup)
+                    || skipSpace(p, eol) != eol) {
+                badRecord(lineStart, eol, "particle record");
+            }
+            buffer.idup.push_back(idup);
+            buffer.istup.push_back(istup);
+            buffer.mothup1.push_back(mothup1);
+            buffer.mothup2.push_back(mothup2);
+            buffer.icolup1.push_back(icolup1);
+            buffer.icolup2.push_back(icolup2);
+            buffer.px.push_back(px);
+            buffer.py.push_back(py);
+            buffer.pz.push_back(pz);
+            buffer.e.push_back(e);
+            buffer.m.push_back(m);
+            buffer.vtimup.push_back(vtimup);
+            buffer.spinup.push_back(spinup);
         }
 
-        if (!foundEventElement) {
-            std::cerr << "WARNING: No next <event> element was found by the LHE reader." << std::endl;
-            return NULL;
+        return true;
+    }
+
+    const char* LHEReader::view(std::uint64_t offset, std::size_t length, std::size_t& available) {
+
+        if (!stream_) {
+            available = offset < textSize_ ? textSize_ - offset : 0;
+            return begin_ + std::min(offset, textSize_);
         }
 
-        getline(ifs_, line);
+        // Text before the window can only be reached by decompressing again.
+        if (offset < windowBegin_) {
+            restartStream();
+        }
 
-        LHEEvent* nextEvent = new LHEEvent(line);
+        // Decompress and drop the text up to the offset.
+        while (windowBegin_ + windowSize_ < offset && !streamEnd_) {
+            windowBegin_ += windowSize_;
+            windowSize_ = 0;
+            windowSize_ = inflateInto(window_.data(), std::min<std::uint64_t>(window_.size(), offset - windowBegin_));
+        }
 
-        while (getline(ifs_, line)) {
+        // Move the text at the offset to the front of the window.
+        std::size_t shift = std::min<std::uint64_t>(offset - windowBegin_, windowSize_);
+        if (shift > 0) {
+            memmove(window_.data(), window_.data() + shift, windowSize_ - shift);
+            windowSize_ -= shift;
+            windowBegin_ += shift;
+        }
 
-            if (line == "</event>") {
-                break;
+        // Fill the window up to the requested length.
+        if (length > window_.size()) {
+            window_.resize(length);
+        }
+        if (windowSize_ < length && !streamEnd_) {
+            windowSize_ += inflateInto(window_.data() + windowSize_, window_.size() - windowSize_);
+        }
+
+        available = offset == windowBegin_ ? windowSize_ : 0;
+        return window_.data();
+    }
+
+    void LHEReader::restartStream() {
+        inflateReset(stream_);
+        stream_->next_in = nullptr;
+        stream_->avail_in = 0;
+        compressedNext_ = static_cast<const char*>(mapping_);
+        compressedRemaining_ = fileSize_;
+        streamEnd_ = false;
+        windowBegin_ = 0;
+        windowSize_ = 0;
+    }
+
+    std::size_t LHEReader::inflateInto(char* out, std::size_t space) {
+
+        std::size_t produced = 0;
+        while (produced < space && !streamEnd_) {
+
+            // The input is fed in pieces since zlib counts bytes with 32 bits.
+            if (stream_->avail_in == 0 && compressedRemaining_ > 0) {
+                std::size_t piece = std::min<std::size_t>(compressedRemaining_, 1 << 30);
+                stream_->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressedNext_));
+                stream_->avail_in = piece;
+                compressedNext_ += piece;
+                compressedRemaining_ -= piece;
             }
 
-	    if (line.find("#")==std::string::npos) {	    // not a comment line
-		LHEParticle* particle = new LHEParticle(line);
-		nextEvent->addParticle(particle);
-	    } else {
-		if (line.find("#vertex")!=std::string::npos) {
-		    nextEvent->setVertex(line);
-		}
-	    }
-        }
-
-        const std::vector<LHEParticle*>& particles = nextEvent->getParticles();
-        int particleIndex = 0;
-        for (std::vector<LHEParticle*>::const_iterator it = particles.begin(); it != particles.end(); it++) {
-            LHEParticle* particle = (*it);
-            if (particle->getMOTHUP(0) != 0) {
-                int mother1 = particle->getMOTHUP(0);
-                int mother2 = particle->getMOTHUP(1);
-                if (mother1 > 0) {
-                    particle->setMother(0, particles[mother1 - 1]);
+            std::size_t space_left = std::min<std::size_t>(space - produced, 1 << 30);
+            stream_->next_out = reinterpret_cast<Bytef*>(out + produced);
+            stream_->avail_out = space_left;
+            int status = ::inflate(stream_, Z_NO_FLUSH);
+            produced += space_left - stream_->avail_out;
+
+            if (status == Z_STREAM_END) {
+                if (stream_->avail_in == 0 && compressedRemaining_ == 0) {
+                    streamEnd_ = true;
+                    textSize_ = windowBegin_ + windowSize_ + produced;
+                } else {
+                    // Concatenated gzip members.
+                    inflateReset(stream_);
+                }
+            } else if (status != Z_OK) {
+                G4Exception("LHEReader::inflateInto", "LHEReaderError", FatalException,
+                            "Failed to decompress LHE file, it may be truncated or corrupted.");
+            }
+        }
+        return produced;
+    }
+
+    void LHEReader::buildIndex() {
+        eventOffsets_.clear();
+
+        // The text is scanned a window at a time.  Consecutive windows overlap so that
+        // a tag cut by the end of one window is found in the next one, where it is
+        // preceded by at least one character.
+        std::uint64_t offset = 0;
+        while (true) {
+            std::size_t available;
+            const char* begin = view(offset, WINDOW_SIZE, available);
+            const char* end = begin + available;
+            const char* p = offset == 0 ? begin : begin + 1;
+            while (p < end) {
+                const char* tag = static_cast<const char*>(memmem(p, end - p, "<event", 6));
+                if (!tag) {
+                    break;
                 }
-                if (mother2 > 0) {
-                    particle->setMother(1, particles[mother2 - 1]);
+                p = tag + 6;
+                bool lineStart = tag == begin || tag[-1] == '\n';
+                if (lineStart && p < end && (*p == '>' || isSpace(*p))) {
+                    eventOffsets_.push_back(offset + (tag - begin));
                 }
             }
-            ++particleIndex;
+            if (available < WINDOW_SIZE || (!stream_ && offset + available >= textSize_)) {
+                break;
+            }
+            offset += available - TAG_OVERLAP;
+        }
+    }
+
+    bool LHEReader::readIndex(const std::string& indexFileName) {
+        std::ifstream ifs(indexFileName.c_str(), std::ifstream::binary);
+        if (!ifs) {
+            return false;
+        }
+        char magic[sizeof(INDEX_MAGIC)];
+        std::uint64_t fileSize, textSize, nEvents;
+        std::int64_t fileTime;
+        ifs.read(magic, sizeof(magic));
+        ifs.read(reinterpret_cast<char*>(&fileSize), sizeof(fileSize));
+        ifs.read(reinterpret_cast<char*>(&fileTime), sizeof(fileTime));
+        ifs.read(reinterpret_cast<char*>(&textSize), sizeof(textSize));
+        ifs.read(reinterpret_cast<char*>(&nEvents), sizeof(nEvents));
+        if (!ifs || memcmp(magic, INDEX_MAGIC, sizeof(magic)) != 0 || fileSize != fileSize_ || fileTime != fileTime_
+                || (!stream_ && textSize != textSize_)) {
+            return false;
         }
+        eventOffsets_.resize(nEvents);
+        ifs.read(reinterpret_cast<char*>(eventOffsets_.data()), nEvents * sizeof(std::uint64_t));
+        if (!ifs || (nEvents > 0 && eventOffsets_.back() >= textSize)) {
+            eventOffsets_.clear();
+            return false;
+        }
+        textSize_ = textSize;
+        return true;
+    }
 
-        return nextEvent;
+    void LHEReader::writeIndex(const std::string& indexFileName) const {
+
+        // Several threads may open the same file so write to a unique name and rename.
+        std::string tmpFileName = indexFileName + "." + std::to_string(getpid()) + "."
+                + std::to_string(G4Threading::G4GetThreadId());
+        {
+            std::ofstream ofs(tmpFileName.c_str(), std::ofstream::binary);
+            if (!ofs) {
+                return;
+            }
+            std::uint64_t fileSize = fileSize_;
+            std::uint64_t nEvents = eventOffsets_.size();
+            ofs.write(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+            ofs.write(reinterpret_cast<const char*>(&fileSize), sizeof(fileSize));
+            ofs.write(reinterpret_cast<const char*>(&fileTime_), sizeof(fileTime_));
+            ofs.write(reinterpret_cast<const char*>(&textSize_), sizeof(textSize_));
+            ofs.write(reinterpret_cast<const char*>(&nEvents), sizeof(nEvents));
+            ofs.write(reinterpret_cast<const char*>(eventOffsets_.data()), nEvents * sizeof(std::uint64_t));
+            if (!ofs) {
+                ofs.close();
+                std::remove(tmpFileName.c_str());
+                return;
+            }
+        }
+        if (std::rename(tmpFileName.c_str(), indexFileName.c_str()) != 0) {
+            std::remove(tmpFileName.c_str());
+        }
     }
 
 }
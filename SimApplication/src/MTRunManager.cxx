@@ -0,0 +1,84 @@
+/**
+ * @file MTRunManager.cxx
+ * @brief Class providing a multithreaded Geant4 run manager implementation.
+ * @author Omar Moreno, SLAC National Accelerator Laboratory
+ */
+
+#include "SimApplication/MTRunManager.h"
+
+#ifdef G4MULTITHREADED
+
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "SimApplication/ActionInitialization.h"
+#include "SimApplication/DetectorConstruction.h"
+#include "SimApplication/ParallelWorld.h"
+#include "SimApplication/ParallelWorldMessenger.h"
+#include "SimApplication/RootPersistencyMessenger.h"
+#include "SimApplication/RootPersistencyManager.h" 
+#include "SimApplication/RunManager.h"
+#include "SimPlugins/PluginManager.h"
+#include "SimPlugins/PluginMessenger.h"
+
+//------------//
+//   Geant4   //
+//------------//
+#include "G4GDMLParser.hh"
+
+//----------//
+//   ROOT   //
+//----------//
+#include "TROOT.h"
+
+namespace ldmx {
+
+    MTRunManager::MTRunManager() {
+        pluginManager_ = new PluginManager();
+        pluginMessenger_ = new PluginMessenger(pluginManager_);
+        pwMessenger_ = new ParallelWorldMessenger(this);
+
+        // Output objects are created on all of the workers.
+        ROOT::EnableThreadSafety();
+    }
+
+    MTRunManager::~MTRunManager() {
+        delete pluginManager_;
+        delete pluginMessenger_;
+    }
+
+    void MTRunManager::InitializePhysics() {
+
+        SetUserInitialization(RunManager::createPhysicsList(isPWEnabled_));
+
+        G4MTRunManager::InitializePhysics();
+    }
+
+    void MTRunManager::Initialize() {
+
+        // The parallel world needs to be registered before the mass world is
+        // constructed i.e. before G4MTRunManager::Initialize() is called. 
+        if (isPWEnabled_) {
+            std::cout << "[ MTRunManager ]: Parallel worlds have been enabled." << std::endl;
+
+            G4GDMLParser* pwParser = new G4GDMLParser();
+            pwParser->Read(parallelWorldPath_);
+            this->getDetectorConstruction()->RegisterParallelWorld(new ParallelWorld(pwParser, "ldmxParallelWorld"));
+        }
+
+        SetUserInitialization(new ActionInitialization);
+
+        G4MTRunManager::Initialize();
+
+        // The master writes the events built by the workers.
+        RootPersistencyManager* rootIO = new RootPersistencyManager();
+        new RootPersistencyMessenger(rootIO);
+    }
+
+    DetectorConstruction* MTRunManager::getDetectorConstruction() {
+        return static_cast<DetectorConstruction*>(this->userDetector); 
+    }
+
+} // ldmx 
+
+#endif // G4MULTITHREADED
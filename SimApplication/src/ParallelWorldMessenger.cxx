@@ -6,10 +6,28 @@
 
 #include "SimApplication/ParallelWorldMessenger.h"
 
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "SimApplication/MTRunManager.h"
+
 namespace ldmx { 
    
     ParallelWorldMessenger::ParallelWorldMessenger(RunManager* runManager) :
    runManager_(runManager) {
+        setupCommands();
+    }
+
+    ParallelWorldMessenger::ParallelWorldMessenger(MTRunManager* mtRunManager) :
+   mtRunManager_(mtRunManager) {
+        setupCommands();
+
+        // The parallel world is registered on the master only.
+        enablePWCmd_->SetToBeBroadcasted(false);
+        readCmd_->SetToBeBroadcasted(false);
+    }
+
+    void ParallelWorldMessenger::setupCommands() {
         
         pwDir_->SetGuidance("UI commands specific to parallel worlds.");
         
@@ -28,6 +46,14 @@ namespace ldmx {
 
     void ParallelWorldMessenger::SetNewValue(G4UIcommand* command, G4String newValues) { 
         
+#ifdef G4MULTITHREADED
+        if (mtRunManager_) {
+            if (command == enablePWCmd_) mtRunManager_->enableParallelWorld(true);
+            else if (command == readCmd_) mtRunManager_->setParallelWorldPath(newValues); 
+            return;
+        }
+#endif
+
         if (command == enablePWCmd_) runManager_->enableParallelWorld(true);
         else if (command == readCmd_) runManager_->setParallelWorldPath(newValues); 
     }
@@ -15,6 +15,15 @@
 #include "SimApplication/PrimaryGeneratorAction.h"
 #include "SimApplication/RootPrimaryGenerator.h"
 
+//------------//
+//   Geant4   //
+//------------//
+#include "G4Threading.hh"
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <sstream>
 
 namespace ldmx {
 
@@ -30,6 +39,10 @@ namespace ldmx {
         lheOpenCmd_ = new G4UIcommand("/ldmx/generators/lhe/open", this);
         G4UIparameter* lhefilename = new G4UIparameter("filename", 's', true);
         lheOpenCmd_->SetParameter(lhefilename);
+        G4UIparameter* lhefirstevent = new G4UIparameter("firstEvent", 'i', true);
+        lhefirstevent->SetDefaultValue(0);
+        lheOpenCmd_->SetParameter(lhefirstevent);
+        lheOpenCmd_->SetGuidance("Open an LHE file, optionally starting from the given event index.");
         lheOpenCmd_->AvailableForStates(G4ApplicationState::G4State_PreInit, G4ApplicationState::G4State_Idle);
 
         // root commands
@@ -42,6 +55,10 @@ namespace ldmx {
         rootOpenCmd_->AvailableForStates(G4ApplicationState::G4State_PreInit, G4ApplicationState::G4State_Idle);
 
         rootUseSeedCmd_->AvailableForStates(G4ApplicationState::G4State_PreInit, G4ApplicationState::G4State_Idle);
+        rootFirstEntryCmd_->AvailableForStates(G4ApplicationState::G4State_PreInit, G4ApplicationState::G4State_Idle);
+        rootFirstEntryCmd_->SetGuidance("Tree entry used for the first event.");
+        rootStrideCmd_->AvailableForStates(G4ApplicationState::G4State_PreInit, G4ApplicationState::G4State_Idle);
+        rootStrideCmd_->SetGuidance("Number of tree entries between consecutive events.");
 
         //
         // GPS commands
@@ -63,7 +80,11 @@ namespace ldmx {
 
         ///////// LHE input
         if (command == lheOpenCmd_) { 
-            primaryGeneratorAction_->setPrimaryGenerator(new LHEPrimaryGenerator(new LHEReader(newValues))); 
+            std::istringstream values(newValues);
+            std::string fileName;
+            int firstEvent = 0;
+            values >> fileName >> firstEvent;
+            primaryGeneratorAction_->setPrimaryGenerator(new LHEPrimaryGenerator(new LHEReader(fileName), firstEvent)); 
         }
     
         ///////// ROOT input
@@ -77,6 +98,12 @@ namespace ldmx {
         } else if (command == rootRegenCmd_) {
             int curi = primaryGeneratorAction_->getIndexRPG();
             if (curi >= 0) ( dynamic_cast<RootPrimaryGenerator*>(primaryGeneratorAction_->getGenerator(curi)) )->setRunMode( 0 ); 
+        } else if (command == rootFirstEntryCmd_) {
+            int curi = primaryGeneratorAction_->getIndexRPG();
+            if (curi >= 0) ( dynamic_cast<RootPrimaryGenerator*>(primaryGeneratorAction_->getGenerator(curi)) )->setFirstEntry( G4UIcommand::ConvertToInt(newValues) ); 
+        } else if (command == rootStrideCmd_) {
+            int curi = primaryGeneratorAction_->getIndexRPG();
+            if (curi >= 0) ( dynamic_cast<RootPrimaryGenerator*>(primaryGeneratorAction_->getGenerator(curi)) )->setStride( G4UIcommand::ConvertToInt(newValues) ); 
         }
 
         //////// MPGun commands
@@ -117,4 +144,12 @@ namespace ldmx {
             primaryGeneratorAction_->setPrimaryGenerator(new GeneralParticleSource());  
         }
     }
+
+    std::string PrimaryGeneratorMessenger::getRootSeedFile() {
+        if (G4Threading::IsWorkerThread()) {
+            return "G4Worker" + std::to_string(G4Threading::G4GetThreadId()) + "_tmpEvent.rndm";
+        }
+        return "tmpEvent.rndm";
+    }
+
 }
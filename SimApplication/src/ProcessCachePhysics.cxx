@@ -0,0 +1,30 @@
+/**
+ * @file ProcessCachePhysics.cxx
+ * @brief Physics constructor that fills the process cache
+ * @author Omar Moreno, SLAC National Accelerator Laboratory
+ */
+
+#include "SimApplication/ProcessCachePhysics.h"
+
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "Event/SimParticle.h"
+#include "SimCore/ProcessCache.h"
+
+namespace ldmx {
+
+    ProcessCachePhysics::ProcessCachePhysics(const G4String& name) :
+            G4VPhysicsConstructor(name) {
+    }
+
+    ProcessCachePhysics::~ProcessCachePhysics() {
+    }
+
+    void ProcessCachePhysics::ConstructProcess() {
+        ProcessCache::getInstance()->build([](const std::string& processName) -> int {
+            return SimParticle::findProcessType(processName);
+        });
+    }
+
+}
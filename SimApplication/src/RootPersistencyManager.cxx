@@ -23,12 +23,12 @@
 #include "Event/Event.h"
 #include "Event/EventHeader.h"
 #include "Event/RunHeader.h"
+#include "Event/SimParticle.h"
 #include "Framework/EventFile.h"
 #include "Framework/EventImpl.h"
 #include "Event/EventConstants.h"
 #include "SimApplication/CalorimeterSD.h"
 #include "SimApplication/DetectorConstruction.h"
-#include "SimApplication/RunManager.h"
 #include "SimApplication/TrackerSD.h"
 #include "SimApplication/ScoringPlaneSD.h"
 
@@ -39,17 +39,25 @@
 #include "G4RunManager.hh"
 #include "G4RunManagerKernel.hh"
 #include "G4SDManager.hh"
+#include "G4Threading.hh"
 
 namespace ldmx {
 
+    RootPersistencyManager* RootPersistencyManager::master_{nullptr};
+
     RootPersistencyManager::RootPersistencyManager() :
         G4PersistencyManager(G4PersistencyCenter::GetPersistencyCenter(), "RootPersistencyManager"), 
-        ecalHitIO_(new EcalHitIO(&simParticleBuilder_)) 
+        ecalHitIO_(new EcalHitIO(&simParticleBuilder_)),
+        isWorker_(G4Threading::IsWorkerThread())
     {
         G4PersistencyCenter::GetPersistencyCenter()->RegisterPersistencyManager(this);
         G4PersistencyCenter::GetPersistencyCenter()->SetPersistencyManager(this, "RootPersistencyManager");
 
         event_ = new EventImpl("sim");
+
+        if (!isWorker_) {
+            master_ = this;
+        }
     }
 
     G4bool RootPersistencyManager::Store(const G4Event* anEvent) {
@@ -60,6 +68,10 @@ namespace ldmx {
         }
 
         if (G4RunManager::GetRunManager()->GetCurrentEvent()->IsAborted()) {
+            // The master still needs the event ID to keep the output in order.
+            if (isWorker_) {
+                master_->submitEvent(anEvent->GetEventID(), nullptr);
+            }
             // TODO: Need event cleanup here?
             return false;
         }
@@ -70,11 +82,94 @@ namespace ldmx {
         // Print out event info and data depending on verbose level.
         printEvent(event_);
 
-        outputFile_->nextEvent();
+        if (isWorker_) {
+            queueEvent(anEvent);
+        } else {
+            outputFile_->nextEvent();
+        }
 
         return true;
     }
 
+    void RootPersistencyManager::queueEvent(const G4Event* anEvent) {
+
+        std::unique_ptr<QueuedEvent> queued(new QueuedEvent);
+        ((EventImpl*) event_)->getEventHeaderMutable().Copy(queued->header);
+
+        // Move the output objects into collections owned by the queued event.
+        auto moveCollection = [&queued](const std::string& name, TClonesArray* coll) {
+            TClonesArray* moved = new TClonesArray(coll->GetClass(), coll->GetEntriesFast());
+            moved->AbsorbObjects(coll);
+            queued->collections.push_back(std::make_pair(name, moved));
+        };
+
+        moveCollection("SimParticles", event_->get<TClonesArray*>("SimParticles", "sim"));
+        for (auto entry : outputHitsCollections_) {
+            if (std::find(dropCollectionNames_.begin(), dropCollectionNames_.end(), entry.first) 
+                    == dropCollectionNames_.end()) {
+                moveCollection(entry.first, entry.second);
+            }
+        }
+
+        // Reset the event of this thread for the next one.
+        ((EventImpl*) event_)->Clear();
+        ((EventImpl*) event_)->onEndOfEvent();
+
+        master_->submitEvent(anEvent->GetEventID(), std::move(queued));
+    }
+
+    void RootPersistencyManager::submitEvent(int eventID, std::unique_ptr<QueuedEvent> event) {
+
+        std::unique_lock<std::mutex> lock(queueMutex_);
+
+        // Hold back a worker which is too far ahead.  The next event to be 
+        // written is always accepted, so the workers cannot all be waiting.
+        queueCondition_.wait(lock, [this, eventID] { 
+            return eventID < nextEventID_ + std::max(maxPendingEvents_, 1); 
+        });
+
+        pending_[eventID] = std::move(event);
+
+        // Write out all of the events that are now in order.
+        auto next = pending_.begin();
+        while (next != pending_.end() && next->first == nextEventID_) {
+            if (next->second) {
+                writeQueuedEvent(next->second.get());
+            }
+            next = pending_.erase(next);
+            ++nextEventID_;
+        }
+        queueCondition_.notify_all();
+    }
+
+    void RootPersistencyManager::writeQueuedEvent(QueuedEvent* queued) {
+
+        queued->header.Copy(((EventImpl*) event_)->getEventHeaderMutable());
+
+        std::vector<int> sizes;
+        for (auto& coll : queued->collections) {
+            TClonesArray*& output = masterCollections_[coll.first];
+            if (!output) {
+                output = new TClonesArray(coll.second->GetClass(), 50);
+            }
+            sizes.push_back(coll.second->GetEntriesFast());
+            output->AbsorbObjects(coll.second);
+            event_->add(coll.first, output);
+        }
+
+        outputFile_->nextEvent();
+
+        // The cleared output collections still hold the objects, so hand them 
+        // back to the queued event which deletes them.
+        for (int iColl = 0; iColl < queued->collections.size(); iColl++) {
+            TClonesArray* output = masterCollections_[queued->collections[iColl].first];
+            for (int iObj = 0; iObj < sizes[iColl]; iObj++) {
+                output->ConstructedAt(iObj);
+            }
+            queued->collections[iColl].second->AbsorbObjects(output);
+        }
+    }
+
     void RootPersistencyManager::writeRunHeader(const G4Run* aRun) {
         RunHeader* runHeader = createRunHeader(aRun);
         outputFile_->writeRunHeader(runHeader);
@@ -86,6 +181,22 @@ namespace ldmx {
             std::cout << "[ RootPersistencyManager ] : Storing run " << aRun->GetRunID() << std::endl;
         }
 
+        // Workers do not own an output file.
+        if (isWorker_) {
+            return true;
+        }
+
+        // Write out any events still waiting for one that was never submitted.
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            for (auto& entry : pending_) {
+                if (entry.second) {
+                    writeQueuedEvent(entry.second.get());
+                }
+            }
+            pending_.clear();
+        }
+
         // Write out the run header.
         writeRunHeader(aRun);
 
@@ -99,6 +210,14 @@ namespace ldmx {
 
     void RootPersistencyManager::Initialize() {
 
+        if (isWorker_) {
+            setupHitsCollectionMap();
+            return;
+        }
+
+        nextEventID_ = 0;
+        pending_.clear();
+
         if (m_verbose > 1) {
             std::cout << "[ RootPersistencyManager ] : Opening output file " << fileName_ << std::endl;
         }
@@ -174,7 +293,8 @@ namespace ldmx {
             eventHeader.setWeight(anEvent->GetPrimaryVertex(0)->GetWeight());
         }
 
-        std::string seedString = getEventSeeds();
+        std::string seedString = isWorker_ ? 
+            getEventSeeds("G4Worker" + std::to_string(G4Threading::G4GetThreadId()) + "_currentEvent.rndm") : getEventSeeds();
         eventHeader.setStringParameter("eventSeed", seedString);
 
         if (m_verbose > 1) {
@@ -240,6 +360,10 @@ namespace ldmx {
                 if (collName == EventConstants::ECAL_SIM_HITS) {
                     // Write ECal G4CalorimeterHit collection to output SimCalorimeterHit collection using helper class.
                     ecalHitIO_->writeHitsCollection(calHitsColl, outputHitsColl);
+
+                    // Record that the SimParticle ECal hit flags can be used.
+                    ((EventImpl*) outputEvent)->getEventHeaderMutable().setIntParameter(
+                            SimParticle::ECAL_PARTICLE_FLAGS, ecalHitIO_->getEnableHitContribs());
                 } else {
                     // Write generic G4CalorimeterHit collection to output SimCalorimeterHit collection.
                     writeCalorimeterHitsCollection(calHitsColl, outputHitsColl);
@@ -290,7 +414,7 @@ namespace ldmx {
     RunHeader* RootPersistencyManager::createRunHeader(const G4Run* aRun) {
 
         // Get detector header from the user detector construction.
-        DetectorConstruction* detector = ((RunManager*) RunManager::GetRunManager())->getDetectorConstruction();
+        DetectorConstruction* detector = (DetectorConstruction*) G4RunManager::GetRunManager()->GetUserDetectorConstruction();
         DetectorHeader* detectorHeader = detector->getDetectorHeader();
 
         // Create the run header.
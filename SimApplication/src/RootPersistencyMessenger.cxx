@@ -53,6 +53,12 @@ namespace ldmx {
         comprCmd_->AvailableForStates(G4ApplicationState::G4State_Idle);
         comprCmd_->SetGuidance("Set the output file compression level (1-9).");
 
+        maxPendingCmd_ = new G4UIcmdWithAnInteger("/ldmx/persistency/root/maxPendingEvents", this);
+        maxPendingCmd_->SetParameterName("maxPendingEvents", false);
+        maxPendingCmd_->SetRange("maxPendingEvents >= 1");
+        maxPendingCmd_->AvailableForStates(G4ApplicationState::G4State_Idle);
+        maxPendingCmd_->SetGuidance("Set how far ahead of the next event to be written a worker can get (default 100).");
+
         hitContribsCmd_ = new G4UIcmdWithABool("/ldmx/persistency/root/enableHitContribs", this);
         G4UIparameter* enable = new G4UIparameter("enable", 'b', true);
         hitContribsCmd_->SetParameter(enable);
@@ -83,6 +89,7 @@ namespace ldmx {
         delete enableCmd_;
         delete disableCmd_;
         delete comprCmd_;
+        delete maxPendingCmd_;
         delete rootDir_;
         delete dropCmd_;
         delete descriptionCmd_; 
@@ -109,6 +116,8 @@ namespace ldmx {
             } else if (command == comprCmd_) {
                 int compr = std::stoi(newValues);
                 rootIO_->setCompressionLevel(compr);
+            } else if (command == maxPendingCmd_) {
+                rootIO_->setMaxPendingEvents(maxPendingCmd_->GetNewIntValue(newValues.c_str())); 
             } else if (command == hitContribsCmd_) {
                 rootIO_->setEnableHitContribs(
                         static_cast<G4UIcmdWithABool*>(hitContribsCmd_)->GetNewBoolValue(newValues.c_str()));
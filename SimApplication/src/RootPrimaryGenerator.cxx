@@ -4,8 +4,10 @@
 #include "G4RunManager.hh"
 #include "G4Event.hh"
 #include "G4IonTable.hh"
+#include "G4Threading.hh"
 
 // LDMX
+#include "SimApplication/PrimaryGeneratorMessenger.h"
 #include "SimApplication/UserPrimaryParticleInformation.h"
 #include "Event/SimParticle.h"
 #include "Event/SimTrackerHit.h"
@@ -15,8 +17,18 @@
 #include "G4SystemOfUnits.hh"
 #include "G4PhysicalConstants.hh"
 
+// STL
+#include <cmath>
+#include <string>
+
 namespace ldmx {
 
+    /** Tolerance for treating primary vertex positions as equal [mm]. */
+    static const double VERTEX_QUANTUM = 1e-6;
+
+    /** Size of the tree cache [bytes]. */
+    static const Long64_t CACHE_SIZE = 32 * 1024 * 1024;
+
     RootPrimaryGenerator::RootPrimaryGenerator(G4String filename) {
 
         filename_ = filename;
@@ -31,20 +43,67 @@ namespace ldmx {
         evtCtr_ = 0;
         nEvts_ = itree_->GetEntriesFast();
         runMode_ = 0;
+        setupBranches();
     }
 
     RootPrimaryGenerator::~RootPrimaryGenerator() {
     }
 
+    void RootPrimaryGenerator::setFirstEntry(int firstEntry) {
+        if (firstEntry < 0) {
+            G4Exception("RootPrimaryGenerator::setFirstEntry", "RootPrimaryGeneratorError", FatalErrorInArgument,
+                    ("First entry " + std::to_string(firstEntry) + " is negative.").c_str());
+        }
+        firstEntry_ = firstEntry;
+    }
+
+    void RootPrimaryGenerator::setStride(int stride) {
+        if (stride < 1) {
+            G4Exception("RootPrimaryGenerator::setStride", "RootPrimaryGeneratorError", FatalErrorInArgument,
+                    ("Stride " + std::to_string(stride) + " is less than 1.").c_str());
+        }
+        stride_ = stride;
+    }
+
+    void RootPrimaryGenerator::setupBranches() {
+
+        // Scoring plane hits are only needed to generate from the ECal scoring plane.
+        std::vector<std::string> branches {EventConstants::EVENT_HEADER, "SimParticles_sim"};
+        if (runMode_ == 1) {
+            branches.push_back("EcalScoringPlaneHits_sim");
+        }
+
+        itree_->SetBranchStatus("*", 0);
+        itree_->SetCacheSize(CACHE_SIZE);
+        for (const auto& branch : branches) {
+            itree_->SetBranchStatus((branch + "*").c_str(), 1);
+            itree_->AddBranchToCache(branch.c_str(), true);
+        }
+        itree_->StopCacheLearningPhase();
+        if (runMode_ != 1) {
+            ecalSPParticles_->Clear("C");
+        }
+    }
+
     void RootPrimaryGenerator::GeneratePrimaryVertex(G4Event* anEvent) {
 
-        if (evtCtr_ >= nEvts_) {
+        // Worker threads each open the file, so read the entry matching the
+        // ID of this event.
+        if (G4Threading::IsWorkerThread()) {
+            evtCtr_ = anEvent->GetEventID();
+        }
+
+        Long64_t entry = firstEntry_ + (Long64_t) stride_ * evtCtr_;
+        if (entry >= nEvts_) {
             std::cout << "[ RootPrimaryGenerator ]: End of file reached." << std::endl;
             G4RunManager::GetRunManager()->AbortRun(true);
             anEvent->SetEventAborted();
+            return;
         }
 
-        itree_->GetEntry(evtCtr_);
+        itree_->GetEntry(entry);
+        resolver_.build(simParticles_);
+        resolver_.resolve(ecalSPParticles_);
 
         // Mode == 0; regenerate the same events (with the useSeed option toggled on)
         // Mode == 1; generate events from the ecal scoring plane hits
@@ -94,8 +153,8 @@ namespace ldmx {
         }
         else if (theMode == 0){
 
-            // put in protection for if we run out of ROOT events
-            std::vector<G4PrimaryVertex*> vertices;
+            // Primaries produced at the same position share a vertex.
+            vertexMap_.clear();
             for (int iSP = 0; iSP < simParticles_->GetEntriesFast(); ++iSP) {
 
                 // check if particle has status 1
@@ -103,22 +162,14 @@ namespace ldmx {
                 if (sp->getGenStatus() != 1)
                     continue;
 
-                bool vertexExists = false;
-                G4PrimaryVertex* curvertex = new G4PrimaryVertex();
-                for (unsigned int iV = 0; iV < vertices.size(); ++iV) {
-                    double cur_vx = sp->getVertex()[0];
-                    double cur_vy = sp->getVertex()[1];
-                    double cur_vz = sp->getVertex()[2];
-                    double i_vx = vertices.at(iV)->GetX0();
-                    double i_vy = vertices.at(iV)->GetY0();
-                    double i_vz = vertices.at(iV)->GetZ0();
-                    if ((cur_vx == i_vx) && (cur_vy == i_vy) && (cur_vz == i_vz)) {
-                        vertexExists = true;
-                        curvertex = vertices.at(iV);
-                    }
-                }
-                if (vertexExists == false) {
-                    curvertex->SetPosition(sp->getVertex()[0], sp->getVertex()[1], sp->getVertex()[2]);
+                std::vector<double> position = sp->getVertex();
+                VertexKey key {std::llround(position[0] / VERTEX_QUANTUM), 
+                               std::llround(position[1] / VERTEX_QUANTUM), 
+                               std::llround(position[2] / VERTEX_QUANTUM)};
+                G4PrimaryVertex*& curvertex = vertexMap_[key];
+                if (curvertex == nullptr) {
+                    curvertex = new G4PrimaryVertex();
+                    curvertex->SetPosition(position[0], position[1], position[2]);
                     curvertex->SetWeight(1.);
                     anEvent->AddPrimaryVertex(curvertex);
                 }
@@ -140,7 +191,7 @@ namespace ldmx {
             std::cerr << "Mode value is invalid!" << std::endl;
         }
 
-        std::ofstream tmpout("tmpEvent.rndm");
+        std::ofstream tmpout(PrimaryGeneratorMessenger::getRootSeedFile());
         std::string eventSeed = eventHeader_->getStringParameter("eventSeed");
         tmpout << eventSeed;
         tmpout.close();
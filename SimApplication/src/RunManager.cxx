@@ -12,11 +12,14 @@
 //-------------//
 #include "SimApplication/APrimePhysics.h"
 #include "SimApplication/DetectorConstruction.h"
+#include "SimApplication/EcalFastSimMessenger.h"
+#include "SimApplication/EcalFastSimPhysics.h"
 #include "SimApplication/GammaPhysics.h"
 #include "SimApplication/ParallelWorld.h"
 #include "SimApplication/ParallelWorldMessenger.h"
 #include "SimApplication/PrimaryGeneratorAction.h"
 #include "SimApplication/PrimaryGeneratorMessenger.h"
+#include "SimApplication/ProcessCachePhysics.h"
 #include "SimApplication/RootPersistencyMessenger.h"
 #include "SimApplication/RootPersistencyManager.h" 
 #include "SimApplication/SteppingAction.h"
@@ -51,10 +54,17 @@ namespace ldmx {
 
     void RunManager::InitializePhysics() {
 
+        SetUserInitialization(createPhysicsList(isPWEnabled_));
+
+        G4RunManager::InitializePhysics();
+    }
+
+    G4VUserPhysicsList* RunManager::createPhysicsList(bool isPWEnabled) {
+
         G4VUserPhysicsList* thePhysicsList = new FTFP_BERT;
         G4VModularPhysicsList* modularPhysicsList = dynamic_cast<G4VModularPhysicsList*>(thePhysicsList);
 
-        if (isPWEnabled_) {
+        if (isPWEnabled) {
             std::cout << "[ RunManager ]: Parallel worlds physics list has been registered." << std::endl;
             modularPhysicsList->RegisterPhysics(new G4ParallelWorldPhysics("ldmxParallelWorld"));
         }
@@ -63,6 +73,11 @@ namespace ldmx {
         modularPhysicsList->RegisterPhysics(new GammaPhysics);
         //modularPhysicsList->RegisterPhysics(new TungstenIonPhysics);
 
+        if (EcalFastSimMessenger::isEnabled()) {
+            std::cout << "[ RunManager ]: Enabling frozen shower fast simulation of the ECal." << std::endl;
+            modularPhysicsList->RegisterPhysics(new EcalFastSimPhysics);
+        }
+
         if (BiasingMessenger::isBiasingEnabled()) {
 
             std::cout << "[ RunManager ]: Enabling biasing of particle type " << BiasingMessenger::getParticleType() << std::endl;
@@ -77,9 +92,11 @@ namespace ldmx {
             modularPhysicsList->RegisterPhysics(biasingPhysics);
         }
 
-        SetUserInitialization(thePhysicsList);
+        // Cache the processes once all of them, including the biasing 
+        // wrappers, have been constructed.
+        modularPhysicsList->RegisterPhysics(new ProcessCachePhysics);
 
-        G4RunManager::InitializePhysics();
+        return thePhysicsList;
     }
 
     void RunManager::Initialize() {
@@ -2,10 +2,14 @@
 
 // LDMX
 #include "SimApplication/DetectorConstruction.h"
+#include "SimApplication/EcalFastSimMessenger.h"
+#include "SimApplication/MTRunManager.h"
 #include "SimApplication/RunManager.h"
 #include "SimApplication/SimApplicationMessenger.h"
 
 // STL
+#include <cstdlib>
+#include <string>
 #include <vector>
 #include <iostream>
 
@@ -31,6 +35,19 @@ namespace ldmx {
 
         std::cout << "[ SimApplication ] : starting" << std::endl;
 
+        // The number of worker threads can be given with "-t N".
+        int nThreads = 1;
+        std::vector<char*> args{argv[0]};
+        for (int iArg = 1; iArg < argc; iArg++) {
+            if (std::string(argv[iArg]) == "-t" && iArg + 1 < argc) {
+                nThreads = std::atoi(argv[++iArg]);
+            } else {
+                args.push_back(argv[iArg]);
+            }
+        }
+        argc = args.size();
+        argv = args.data();
+
         // If no arguments then start an interactive session.
         G4UIExecutive* ui = 0;
         if (argc == 1) {
@@ -38,7 +55,22 @@ namespace ldmx {
         }
 
         // Create run manager.
-        G4RunManager* runManager = new RunManager;
+        G4RunManager* runManager = nullptr;
+#ifdef G4MULTITHREADED
+        if (nThreads > 1) {
+            std::cout << "[ SimApplication ] : running with " << nThreads << " worker threads" << std::endl;
+            MTRunManager* mtRunManager = new MTRunManager;
+            mtRunManager->SetNumberOfThreads(nThreads);
+            runManager = mtRunManager;
+        }
+#else
+        if (nThreads > 1) {
+            std::cerr << "[ SimApplication ] : Geant4 was built without multithreading; running sequentially" << std::endl;
+        }
+#endif
+        if (!runManager) {
+            runManager = new RunManager;
+        }
 
         // Setup GDML parser and messenger.
         G4GDMLParser* parser = new G4GDMLParser();
@@ -47,6 +79,9 @@ namespace ldmx {
         // Create application messenger.
         new SimApplicationMessenger();
 
+        // Create the messenger of the ECal fast simulation.
+        new EcalFastSimMessenger();
+
         // Instantiate the class so cascade parameters can be set.
         G4CascadeParameters::Instance();  
 
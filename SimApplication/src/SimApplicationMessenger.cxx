@@ -1,5 +1,8 @@
 #include "SimApplication/SimApplicationMessenger.h"
 
+// LDMX
+#include "SimApplication/Trajectory.h"
+
 // Geant4
 #include "G4ApplicationState.hh"
 
@@ -8,11 +11,20 @@ namespace ldmx {
     SimApplicationMessenger::SimApplicationMessenger() {
         ldmxDir_ = new G4UIdirectory("/ldmx/");
         ldmxDir_->SetGuidance("LDMX Simulation Application commands");
+
+        storeTrajectoryPointsCmd_ = new G4UIcmdWithoutParameter("/ldmx/storeTrajectoryPoints", this);
+        storeTrajectoryPointsCmd_->SetGuidance("Record a point for every step of the trajectories (debugging only).");
+        storeTrajectoryPointsCmd_->SetToBeBroadcasted(false);
     }
 
-    SimApplicationMessenger::~SimApplicationMessenger() {}
+    SimApplicationMessenger::~SimApplicationMessenger() {
+        delete storeTrajectoryPointsCmd_;
+    }
 
-    void SimApplicationMessenger::SetNewValue(G4UIcommand*, G4String) {
+    void SimApplicationMessenger::SetNewValue(G4UIcommand* command, G4String) {
+        if (command == storeTrajectoryPointsCmd_) {
+            Trajectory::setStoreAllPoints(true);
+        }
     }
 
 }
@@ -17,8 +17,7 @@
 namespace ldmx {
 
     SimParticleBuilder::SimParticleBuilder() :
-            currentEvent_(nullptr) {
-        trackMap_ = UserTrackingAction::getUserTrackingAction()->getTrackMap();
+            trackMap_(nullptr), currentEvent_(nullptr) {
         outputParticleColl_ = new TClonesArray(EventConstants::SIM_PARTICLE.c_str(), 50);
     }
 
@@ -31,6 +30,9 @@ namespace ldmx {
         // Clear the output particle collection.
         outputParticleColl_->Clear("C");
 
+        // Get the track map from the tracking action of this thread.
+        trackMap_ = UserTrackingAction::getUserTrackingAction()->getTrackMap();
+
         // Get the trajectory container for the event.
         TrajectoryContainer* trajectories = (TrajectoryContainer*) (const_cast<G4Event*>(currentEvent_))->GetTrajectoryContainer();
 
@@ -92,7 +94,10 @@ namespace ldmx {
     void SimParticleBuilder::buildParticleMap(TrajectoryContainer* trajectories, TClonesArray* simParticleColl) {
         particleMap_.clear();
         for (auto trajectory : *trajectories->GetVector()) {
-            particleMap_[trajectory->GetTrackID()] = (SimParticle*) simParticleColl->ConstructedAt(simParticleColl->GetEntries());
+            SimParticle* simParticle = (SimParticle*) simParticleColl->ConstructedAt(simParticleColl->GetEntries());
+            // The track ID is needed up front since parent/daughter links are persisted by track ID.
+            simParticle->setTrackID(trajectory->GetTrackID());
+            particleMap_[trajectory->GetTrackID()] = simParticle;
         }
     }
 
@@ -13,12 +13,13 @@ namespace ldmx {
         G4int currTrackID = trackID;
         G4VTrajectory* traj = nullptr;
         for (;;) {
-            traj = trajectoryMap_[currTrackID];
+            traj = getTrajectory(currTrackID);
             if (traj) {
                 break;
             } else {
-                if (trackIDMap_.find(currTrackID) != trackIDMap_.end()) {
-                    currTrackID = trackIDMap_[currTrackID];
+                auto parent = trackIDMap_.find(currTrackID);
+                if (parent != trackIDMap_.end()) {
+                    currTrackID = parent->second;
                 } else {
                     break;
                 }
@@ -129,12 +129,15 @@ namespace ldmx {
 
         // Setup hits collection and the HC ID.
         hitsCollection_ = new G4TrackerHitsCollection(SensitiveDetectorName, collectionName[0]);
+        hitsCollection_->GetVector()->reserve(capacityHint_.get());
         int hcID = G4SDManager::GetSDMpointer()->GetCollectionID(collectionName[0]);
         hce->AddHitsCollection(hcID, hitsCollection_);
     }
 
     void TrackerSD::EndOfEvent(G4HCofThisEvent*) {
 
+        capacityHint_.update(hitsCollection_->entries());
+
         // Print number of hits.
         if (this->verboseLevel > 0) {
             std::cout << GetName() << " had " << hitsCollection_->entries() << " hits in event" << std::endl;
@@ -1,6 +1,8 @@
 #include "SimApplication/Trajectory.h"
 
 // LDMX
+#include "SimApplication/TrajectoryContainer.h"
+#include "SimCore/ProcessCache.h"
 #include "SimCore/UserTrackInformation.h"
 #include "Event/SimParticle.h"
 
@@ -10,7 +12,9 @@
 
 namespace ldmx {
 
-    G4Allocator<Trajectory> TrajectoryAllocator;
+    G4ThreadLocal G4Allocator<Trajectory>* TrajectoryAllocator = nullptr;
+
+    bool Trajectory::storeAllPoints_{false};
 
     Trajectory::Trajectory(const G4Track* aTrack) :
             genStatus_(0) {
@@ -27,12 +31,10 @@ namespace ldmx {
         // Set the process type.
         const G4VProcess* process = aTrack->GetCreatorProcess();
         if (process) {
-            const G4String& processName = process->GetProcessName();
-            SimParticle::ProcessType processType = SimParticle::findProcessType(processName);
-            processType_ = processType;
+            processType_ = ProcessCache::getInstance()->getType(process);
             // Uncomment this to see what process types are being saved.  --JM
-            //std::cout << "Trajectory - set process type " << processType
-            //        << " from <" << processName << ">" << std::endl;
+            //std::cout << "Trajectory - set process type " << processType_
+            //        << " from <" << process->GetProcessName() << ">" << std::endl;
         } else {
             processType_ = SimParticle::ProcessType::unknown;
         }
@@ -45,25 +47,41 @@ namespace ldmx {
         // If the track has not been stepped, then only the first point is added.
         // Otherwise, the track has already been stepped so we add also its last location
         // which should be its endpoint.
-        trajPoints_ = new TrajectoryPointContainer();
-        trajPoints_->push_back(new G4TrajectoryPoint(aTrack->GetVertexPosition()));
+        vertexPoint_.setPosition(aTrack->GetVertexPosition());
+        endPoint_.setPosition(aTrack->GetVertexPosition());
         if (aTrack->GetTrackStatus() == G4TrackStatus::fStopAndKill) {
-            trajPoints_->push_back(new G4TrajectoryPoint(aTrack->GetPosition()));
+            endPoint_.setPosition(aTrack->GetPosition());
+            hasEndPoint_ = true;
+        }
+
+        if (storeAllPoints_) {
+            trajPoints_ = new TrajectoryPointContainer();
+            trajPoints_->push_back(new G4TrajectoryPoint(vertexPoint_.GetPosition()));
+            if (hasEndPoint_) {
+                trajPoints_->push_back(new G4TrajectoryPoint(endPoint_.GetPosition()));
+            }
         }
     }
 
     Trajectory::~Trajectory() {
         // Delete trajectory points and their container.
-        size_t i;
-        for (i = 0; i < trajPoints_->size(); i++) {
-            delete (*trajPoints_)[i];
+        if (trajPoints_) {
+            size_t i;
+            for (i = 0; i < trajPoints_->size(); i++) {
+                delete (*trajPoints_)[i];
+            }
+            trajPoints_->clear();
+            delete trajPoints_;
         }
-        trajPoints_->clear();
-        delete trajPoints_;
     }
 
     void Trajectory::AppendStep(const G4Step* aStep) {
-        trajPoints_->push_back(new G4TrajectoryPoint(aStep->GetPostStepPoint()->GetPosition()));
+        const G4ThreeVector& position = aStep->GetPostStepPoint()->GetPosition();
+        endPoint_.setPosition(position);
+        hasEndPoint_ = true;
+        if (trajPoints_) {
+            trajPoints_->push_back(new G4TrajectoryPoint(position));
+        }
     }
 
     G4int Trajectory::GetTrackID() const {
@@ -91,11 +109,17 @@ namespace ldmx {
     }
 
     int Trajectory::GetPointEntries() const {
-        return trajPoints_->size();
+        if (trajPoints_) {
+            return trajPoints_->size();
+        }
+        return hasEndPoint_ ? 2 : 1;
     }
 
     G4VTrajectoryPoint* Trajectory::GetPoint(G4int i) const {
-        return (*trajPoints_)[i];
+        if (trajPoints_) {
+            return (*trajPoints_)[i];
+        }
+        return const_cast<TrajectoryPoint*>(i == 0 ? &vertexPoint_ : &endPoint_);
     }
 
     void Trajectory::MergeTrajectory(G4VTrajectory* secondTrajectory) {
@@ -104,16 +128,23 @@ namespace ldmx {
         }
 
         Trajectory* seco = (Trajectory*) secondTrajectory;
-        G4int ent = seco->GetPointEntries();
-        for (int i = 1; i < ent; i++) {
-            trajPoints_->push_back((*(seco->trajPoints_))[i]);
+        if (seco->hasEndPoint_) {
+            endPoint_ = seco->endPoint_;
+            hasEndPoint_ = true;
+        }
+
+        if (trajPoints_ && seco->trajPoints_) {
+            G4int ent = seco->GetPointEntries();
+            for (int i = 1; i < ent; i++) {
+                trajPoints_->push_back((*(seco->trajPoints_))[i]);
+            }
+            delete (*seco->trajPoints_)[0];
+            seco->trajPoints_->clear();
         }
-        delete (*seco->trajPoints_)[0];
-        seco->trajPoints_->clear();
     }
 
     G4ThreeVector Trajectory::getEndPoint() const {
-        return GetPoint(GetPointEntries() - 1)->GetPosition();
+        return endPoint_.GetPosition();
     }
 
     G4double Trajectory::getEnergy() const {
@@ -141,6 +172,10 @@ namespace ldmx {
     }
 
     Trajectory* Trajectory::findByTrackID(G4TrajectoryContainer* trajCont, int trackID) {
+        TrajectoryContainer* indexed = dynamic_cast<TrajectoryContainer*>(trajCont);
+        if (indexed) {
+            return indexed->findByTrackID(trackID);
+        }
         TrajectoryVector* vec = trajCont->GetVector();
         for (TrajectoryVector::const_iterator it = vec->begin(); it != vec->end(); it++) {
             if ((*it)->GetTrackID() == trackID) {
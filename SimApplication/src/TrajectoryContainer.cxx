@@ -3,14 +3,19 @@
 namespace ldmx {
 
     Trajectory* TrajectoryContainer::findByTrackID(G4int trackID) {
-        Trajectory* traj = NULL;
-        for (int iTraj = 0; iTraj < this->entries(); iTraj++) {
-            if ((*this)[iTraj]->GetTrackID() == trackID) {
-                traj = (Trajectory*) (*this)[iTraj];
-                break;
-            }
+        int nEntries = this->entries();
+        if (nEntries < indexedEntries_) {
+            trackIndex_.clear();
+            indexedEntries_ = 0;
         }
-        return traj;
+        for (; indexedEntries_ < nEntries; indexedEntries_++) {
+            trackIndex_.emplace((*this)[indexedEntries_]->GetTrackID(), indexedEntries_);
+        }
+        auto it = trackIndex_.find(trackID);
+        if (it == trackIndex_.end()) {
+            return nullptr;
+        }
+        return static_cast<Trajectory*>((*this)[it->second]);
     }
 
 }
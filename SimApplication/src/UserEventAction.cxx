@@ -30,7 +30,7 @@ namespace ldmx {
         // G4Random::saveEngineStatus();
         // G4Random::getTheEngine();
         if (PrimaryGeneratorMessenger::useRootSeed())
-            G4Random::restoreEngineStatus("tmpEvent.rndm"); // this line will be needed to read in a set of seeds
+            G4Random::restoreEngineStatus(PrimaryGeneratorMessenger::getRootSeedFile().c_str()); // this line will be needed to read in a set of seeds
 
             // Activate user plugins.
         pluginManager_->beginEvent(anEvent);
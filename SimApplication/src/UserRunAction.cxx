@@ -19,13 +19,18 @@ namespace ldmx {
             RootPersistencyManager::getInstance()->Initialize();
         }
 
-        pluginManager_->beginRun(aRun);
+        // The master has no plugins when running with worker threads.
+        if (pluginManager_) {
+            pluginManager_->beginRun(aRun);
+        }
 
     }
 
     void UserRunAction::EndOfRunAction(const G4Run* aRun) {
 
-        pluginManager_->endRun(aRun);
+        if (pluginManager_) {
+            pluginManager_->endRun(aRun);
+        }
     }
 
 }
@@ -0,0 +1,70 @@
+// LDMX
+#include "DetDescr/HcalID.h"
+#include "SimApplication/HcalSD.h"
+
+// Geant4
+#include "G4Box.hh"
+#include "G4LogicalVolume.hh"
+#include "G4NavigationHistory.hh"
+#include "G4PVPlacement.hh"
+#include "G4TouchableHistory.hh"
+
+// STL
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using ldmx::HcalSD;
+
+/**
+ * Check the section and layer found for a step in a scintillator placed with
+ * the given copy number, in a world -> HCal -> scintillator hierarchy as in
+ * the detector descriptions, where the layer depth is 2.
+ */
+void checkLayer(int copyNumber, int expectedSection, int expectedLayer) {
+
+    G4Box worldBox("world", 1000, 1000, 1000);
+    G4LogicalVolume worldLog(&worldBox, nullptr, "world");
+    G4PVPlacement world(nullptr, G4ThreeVector(), &worldLog, "world", nullptr, false, 0);
+
+    G4Box hcalBox("hcal", 500, 500, 500);
+    G4LogicalVolume hcalLog(&hcalBox, nullptr, "hcal");
+    G4PVPlacement hcal(nullptr, G4ThreeVector(), &hcalLog, "hcal", &worldLog, false, 0);
+
+    G4Box scintBox("scint", 500, 500, 3);
+    G4LogicalVolume scintLog(&scintBox, nullptr, "scint");
+    G4PVPlacement scint(nullptr, G4ThreeVector(), &scintLog, "scint", &hcalLog, false, copyNumber);
+
+    G4NavigationHistory history;
+    history.SetFirstEntry(&world);
+    history.NewLevel(&hcal, kNormal, 0);
+    history.NewLevel(&scint, kNormal, copyNumber);
+    G4TouchableHistory touchable(history);
+
+    const G4VPhysicalVolume* layerVolume = HcalSD::getLayerVolume(&touchable, 2);
+    if (layerVolume != &scint) {
+        throw std::runtime_error("Layer volume for copy number " + std::to_string(copyNumber) + " is "
+                + layerVolume->GetName() + " instead of the scintillator");
+    }
+
+    int section, layer;
+    HcalSD::decodeLayer(layerVolume->GetCopyNo(), section, layer);
+    if (section != expectedSection || layer != expectedLayer) {
+        throw std::runtime_error("Copy number " + std::to_string(copyNumber) + " decoded to section "
+                + std::to_string(section) + " layer " + std::to_string(layer));
+    }
+    std::cout << "Copy number " << copyNumber << " is section " << section << " layer " << layer << std::endl;
+}
+
+int main() {
+
+    std::cout << "Hello HcalSD layer test!" << std::endl;
+
+    checkLayer(1, ldmx::HcalSection::BACK, 1);
+    checkLayer(81, ldmx::HcalSection::BACK, 81);
+    checkLayer(1005, ldmx::HcalSection::TOP, 5);
+    checkLayer(2017, ldmx::HcalSection::BOTTOM, 17);
+    checkLayer(4030, ldmx::HcalSection::RIGHT, 30);
+
+    std::cout << "Bye HcalSD layer test!" << std::endl;
+}
@@ -0,0 +1,268 @@
+// LDMX
+#include "SimApplication/LHEReader.h"
+
+// STL
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// zlib
+#include <zlib.h>
+
+using ldmx::LHEEventBuffer;
+using ldmx::LHEReader;
+
+/** Size of the window the reader decompresses gzip files into. */
+const std::size_t WINDOW_SIZE = 1 << 20;
+
+/** Overlap of consecutive windows when the reader indexes a file. */
+const std::size_t TAG_OVERLAP = 7;
+
+/** The text and expected values of one event. */
+struct ExpectedEvent {
+    std::size_t offset;
+    int nup;
+    int idprup;
+    double xwgtup;
+    double scalup;
+    double vertex[3];
+    std::vector<int> idup;
+    std::vector<int> mothup1;
+    std::vector<double> px;
+    std::vector<double> e;
+    std::vector<double> spinup;
+};
+
+/** Convert a token to a double the slow way, accepting Fortran exponents. */
+double toDouble(std::string token) {
+    for (char& c : token) {
+        if (c == 'd' || c == 'D') c = 'e';
+    }
+    return std::strtod(token.c_str(), nullptr);
+}
+
+/**
+ * Floating point tokens of the forms found in LHE files: fixed and scientific
+ * notation, Fortran 'D' exponents, signs and mantissas too long to be
+ * converted exactly without strtod.
+ */
+std::string doubleToken(int i) {
+    static const char* formats[] = {"%.6f", "%.10e", "%+.8E", "%.17e", "%.3fD-02", "%.15g", "-%.4f", "%.0f."};
+    char token[64];
+    std::snprintf(token, sizeof(token), formats[i % 8], 1.2345678901234567 * (i % 97 + 1) + 0.001 * i);
+    return token;
+}
+
+/**
+ * Generate the text of a file with the given number of events.  Padding is
+ * added in front of some events so that their <event> tag straddles the end
+ * of an indexing window, or ends right at it, or so that the event itself
+ * straddles the end of the first decompression window.
+ */
+std::string makeText(int nEvents, std::vector<ExpectedEvent>& events) {
+
+    std::string text = "<LesHouchesEvents version=\"1.0\">\n<header>\n<eventinfo> not an event </eventinfo>\n"
+                       "</header>\n<init>\n 11 0 4.0 0 0 0 0 0 0 1\n 1.0 0.0 1.0 1\n</init>\n";
+
+    // Positions at which to start a tag: across the end of the first indexing
+    // window, ending right at the end of the second one, and at the start of
+    // the overlap with the next window at the end of the third one.
+    std::vector<std::size_t> targets = {WINDOW_SIZE - 3, (WINDOW_SIZE - TAG_OVERLAP) + WINDOW_SIZE - 6,
+                                        2 * (WINDOW_SIZE - TAG_OVERLAP) + WINDOW_SIZE - TAG_OVERLAP};
+    std::size_t nextTarget = 0;
+
+    for (int ievent = 0; ievent < nEvents; ++ievent) {
+
+        ExpectedEvent event;
+        event.nup = 2 + ievent % 5;
+        event.idprup = ievent % 3 - 1;
+        std::string weight = doubleToken(ievent);
+        std::string scale = doubleToken(ievent + 3);
+        event.xwgtup = toDouble(weight);
+        event.scalup = toDouble(scale);
+
+        std::string body = " " + std::to_string(event.nup) + " " + std::to_string(event.idprup) + " " + weight
+                + "  " + scale + " 7.546771D-03 1.180000E-01\n";
+        for (int ipart = 0; ipart < event.nup; ++ipart) {
+            int idup = ipart % 2 ? 22 : 11;
+            int mothup1 = ipart ? 1 : 0;
+            std::string px = doubleToken(ievent * 7 + ipart);
+            std::string e = doubleToken(ievent * 11 + ipart + 1);
+            std::string spinup = ipart % 2 ? "-1.0" : "+9.";
+            body += "  " + std::to_string(idup) + "  1  " + std::to_string(mothup1) + " 0 0 0 " + px
+                    + " 0.0 -1.5e+00 " + e + " 5.11E-04 0.0 " + spinup + "\n";
+            event.idup.push_back(idup);
+            event.mothup1.push_back(mothup1);
+            event.px.push_back(toDouble(px));
+            event.e.push_back(toDouble(e));
+            event.spinup.push_back(toDouble(spinup));
+        }
+        event.vertex[0] = 0.25 * ievent;
+        event.vertex[1] = -1.5;
+        event.vertex[2] = 1e-3 * ievent;
+        char vertex[128];
+        std::snprintf(vertex, sizeof(vertex), "#vertex %.17g %.17g %.17g\n", event.vertex[0], event.vertex[1],
+                event.vertex[2]);
+        body += vertex;
+        body += "</event>\n";
+
+        // Pad the end of the previous event so that this tag starts at the target.
+        if (nextTarget < targets.size() && text.size() + 2 * body.size() > targets[nextTarget]) {
+            std::size_t pad = targets[nextTarget] - text.size();
+            if (pad > 1) {
+                text += "#" + std::string(pad - 2, ' ') + "\n";
+            } else if (pad == 1) {
+                text += "\n";
+            }
+            ++nextTarget;
+        }
+
+        event.offset = text.size();
+        text += "<event>\n" + body;
+        events.push_back(event);
+    }
+    text += "</LesHouchesEvents>\n";
+
+    if (nextTarget != targets.size()) {
+        throw std::runtime_error("Too few events to reach all window boundaries");
+    }
+    return text;
+}
+
+void checkEvent(const LHEEventBuffer& buffer, const ExpectedEvent& expected, int ievent, const std::string& what) {
+    bool same = buffer.nup == expected.nup && buffer.idprup == expected.idprup
+            && buffer.xwgtup == expected.xwgtup && buffer.scalup == expected.scalup
+            && buffer.aqedup == 7.546771e-03 && buffer.aqcdup == 1.18e-01
+            && buffer.vertex[0] == expected.vertex[0] && buffer.vertex[1] == expected.vertex[1]
+            && buffer.vertex[2] == expected.vertex[2]
+            && buffer.idup == expected.idup && buffer.mothup1 == expected.mothup1
+            && buffer.px == expected.px && buffer.e == expected.e && buffer.spinup == expected.spinup
+            && buffer.m.size() == expected.idup.size() && buffer.m[0] == 5.11e-04 && buffer.pz[0] == -1.5;
+    if (!same) {
+        throw std::runtime_error(what + ": event " + std::to_string(ievent) + " at offset "
+                + std::to_string(expected.offset) + " was not read as written");
+    }
+}
+
+void checkSeek(LHEReader& reader, const std::vector<ExpectedEvent>& events, int ievent, const std::string& what) {
+    LHEEventBuffer buffer;
+    if (!reader.seek(ievent) || !reader.readNextEvent(buffer)) {
+        throw std::runtime_error(what + ": failed to read event " + std::to_string(ievent) + " after seeking");
+    }
+    checkEvent(buffer, events[ievent], ievent, what);
+}
+
+/** Find the events which overlap the end of an indexing window. */
+std::vector<int> eventsAtBoundaries(const std::vector<ExpectedEvent>& events, std::size_t textSize) {
+    std::vector<int> found;
+    for (std::size_t ievent = 0; ievent < events.size(); ++ievent) {
+        std::size_t begin = events[ievent].offset;
+        std::size_t end = ievent + 1 < events.size() ? events[ievent + 1].offset : textSize;
+        for (std::size_t window = 1; window <= 3; ++window) {
+            std::size_t windowEnd = (window - 1) * (WINDOW_SIZE - TAG_OVERLAP) + WINDOW_SIZE;
+            if (begin < windowEnd && end > windowEnd - TAG_OVERLAP) {
+                found.push_back(ievent);
+                break;
+            }
+        }
+    }
+    return found;
+}
+
+/**
+ * Read a file sequentially and by seeking, first with an index built from
+ * the file and then with the index read from the cache.
+ */
+void checkFile(std::string fileName, const std::vector<ExpectedEvent>& events, std::size_t textSize) {
+
+    std::string indexName = fileName + ".idx";
+    std::remove(indexName.c_str());
+
+    std::vector<int> boundaries = eventsAtBoundaries(events, textSize);
+    if (boundaries.size() < 3) {
+        throw std::runtime_error("Only " + std::to_string(boundaries.size()) + " events at window boundaries");
+    }
+
+    for (const std::string& what : {fileName + " with a new index", fileName + " with a cached index"}) {
+
+        LHEReader reader(fileName);
+        if (reader.getNumberOfEvents() != (int) events.size()) {
+            throw std::runtime_error(what + ": found " + std::to_string(reader.getNumberOfEvents())
+                    + " events instead of " + std::to_string(events.size()));
+        }
+
+        LHEEventBuffer buffer;
+        for (std::size_t ievent = 0; ievent < events.size(); ++ievent) {
+            if (!reader.readNextEvent(buffer)) {
+                throw std::runtime_error(what + ": failed to read event " + std::to_string(ievent));
+            }
+            checkEvent(buffer, events[ievent], ievent, what);
+        }
+
+        // Seeking back restarts the decompression of a gzip file.
+        checkSeek(reader, events, events.size() - 1, what);
+        checkSeek(reader, events, 0, what);
+        for (auto it = boundaries.rbegin(); it != boundaries.rend(); ++it) {
+            checkSeek(reader, events, *it, what);
+            checkSeek(reader, events, *it - 1, what);
+        }
+        checkSeek(reader, events, events.size() / 2, what);
+        if (reader.seek(events.size())) {
+            throw std::runtime_error(what + ": seeking past the last event succeeded");
+        }
+
+        std::cout << what << ": " << events.size() << " events with " << boundaries.size()
+                  << " at window boundaries read okay" << std::endl;
+    }
+
+    // The cache of the second reader must have the current format.
+    std::ifstream index(indexName, std::ios::binary);
+    char magic[8] = {0};
+    index.read(magic, sizeof(magic));
+    if (std::string(magic, sizeof(magic)) != "LHEIDX02") {
+        throw std::runtime_error("The index cache of " + fileName + " has the wrong format");
+    }
+}
+
+/** Write the text as two gzip members, as produced by concatenating gzip files. */
+void writeGzip(const std::string& fileName, const std::string& text) {
+    std::size_t half = text.size() / 2;
+    for (int member = 0; member < 2; ++member) {
+        gzFile file = gzopen(fileName.c_str(), member ? "ab" : "wb");
+        const char* data = text.data() + (member ? half : 0);
+        unsigned length = member ? text.size() - half : half;
+        if (!file || gzwrite(file, data, length) != (int) length || gzclose(file) != Z_OK) {
+            throw std::runtime_error("Failed to write " + fileName);
+        }
+    }
+}
+
+/**
+ * Write an LHE file of a few MB, both plain and gzip compressed, with events
+ * placed across the boundaries of the windows used to index and decompress
+ * it, and check that every event is read back as written.
+ */
+int main() {
+
+    std::cout << "Hello LHEReader test!" << std::endl;
+
+    std::vector<ExpectedEvent> events;
+    std::string text = makeText(12000, events);
+
+    const std::string plainName = "lhe_reader_test.lhe";
+    std::ofstream plain(plainName, std::ios::binary);
+    plain.write(text.data(), text.size());
+    plain.close();
+    checkFile(plainName, events, text.size());
+
+    const std::string gzipName = "lhe_reader_test.lhe.gz";
+    writeGzip(gzipName, text);
+    checkFile(gzipName, events, text.size());
+
+    std::cout << "Bye LHEReader test!" << std::endl;
+}
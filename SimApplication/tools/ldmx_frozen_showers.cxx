@@ -0,0 +1,319 @@
+/**
+ * @file ldmx_frozen_showers.cxx
+ * @brief Standalone program recording the frozen shower library of the ECal fast simulation
+ *
+ * Particles are fired along the axis of the ECal envelope at energies and depths
+ * sampled within each library bin, and the energy deposited in the ECal sensors is
+ * recorded relative to the starting point, merged into small voxels.
+ */
+
+//-------------//
+//   ldmx-sw   //
+//-------------//
+#include "SimApplication/DetectorConstruction.h"
+#include "SimApplication/EcalFrozenShowerLibrary.h"
+#include "SimApplication/EcalSD.h"
+#include "SimApplication/RunManager.h"
+
+//------------//
+//   Geant4   //
+//------------//
+#include "G4AffineTransform.hh"
+#include "G4Event.hh"
+#include "G4GDMLParser.hh"
+#include "G4ParticleGun.hh"
+#include "G4ParticleTable.hh"
+#include "G4RunManager.hh"
+#include "G4Step.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4TransportationManager.hh"
+#include "G4UserEventAction.hh"
+#include "G4UserSteppingAction.hh"
+#include "G4VUserPrimaryGeneratorAction.hh"
+#include "Randomize.hh"
+
+//----------//
+//   ROOT   //
+//----------//
+#include "TFile.h"
+#include "TTree.h"
+#include "TVectorD.h"
+
+//----------------//
+//   C++ StdLib   //
+//----------------//
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace ldmx;
+
+namespace {
+
+    /** Transverse voxel size used to merge deposits. */
+    const double VOXEL_XY = 0.5 * mm;
+
+    /** Longitudinal voxel size used to merge deposits, small enough to keep them inside the sensors. */
+    const double VOXEL_Z = 0.05 * mm;
+
+    /**
+     * The shower currently recorded along with the frame of the ECal envelope.
+     */
+    struct ShowerRecord {
+
+        /** Transform from global coordinates to the envelope frame. */
+        G4AffineTransform toEnvelope;
+
+        /** Local z of the front face of the envelope. */
+        double front{0};
+
+        int pdg{0};
+        double energy{0};
+        double depth{0};
+
+        /** Deposited energy per voxel relative to the starting point. */
+        std::map<std::tuple<int, int, int>, double> voxels;
+    };
+
+    /**
+     * Fires one particle per event from the current bin along the envelope axis.
+     */
+    class FrozenShowerGun : public G4VUserPrimaryGeneratorAction {
+
+        public:
+
+            FrozenShowerGun(ShowerRecord& record) : record_(record) {
+            }
+
+            void setBin(int pdg, double minEnergy, double maxEnergy, double minDepth, double maxDepth) {
+                gun_.SetParticleDefinition(G4ParticleTable::GetParticleTable()->FindParticle(pdg));
+                record_.pdg = pdg;
+                minEnergy_ = minEnergy;
+                maxEnergy_ = maxEnergy;
+                minDepth_ = minDepth;
+                maxDepth_ = maxDepth;
+            }
+
+            void GeneratePrimaries(G4Event* event) {
+                record_.energy = minEnergy_ + (maxEnergy_ - minEnergy_) * G4UniformRand();
+                record_.depth = minDepth_ + (maxDepth_ - minDepth_) * G4UniformRand();
+                G4AffineTransform toGlobal = record_.toEnvelope.Inverse();
+                gun_.SetParticleEnergy(record_.energy);
+                gun_.SetParticlePosition(toGlobal.TransformPoint(G4ThreeVector(0, 0, record_.front + record_.depth)));
+                gun_.SetParticleMomentumDirection(toGlobal.TransformAxis(G4ThreeVector(0, 0, 1)));
+                gun_.GeneratePrimaryVertex(event);
+            }
+
+        private:
+
+            ShowerRecord& record_;
+            G4ParticleGun gun_;
+            double minEnergy_{0}, maxEnergy_{0}, minDepth_{0}, maxDepth_{0};
+    };
+
+    /**
+     * Accumulates the energy deposited in the ECal sensors into voxels.
+     */
+    class FrozenShowerStepping : public G4UserSteppingAction {
+
+        public:
+
+            FrozenShowerStepping(ShowerRecord& record) : record_(record) {
+            }
+
+            void UserSteppingAction(const G4Step* step) {
+                double edep = step->GetTotalEnergyDeposit();
+                if (edep <= 0) {
+                    return;
+                }
+                G4LogicalVolume* volume = step->GetPreStepPoint()->GetTouchableHandle()->GetVolume()->GetLogicalVolume();
+                if (!dynamic_cast<EcalSD*>(volume->GetSensitiveDetector())) {
+                    return;
+                }
+                G4ThreeVector position = record_.toEnvelope.TransformPoint(
+                        0.5 * (step->GetPreStepPoint()->GetPosition() + step->GetPostStepPoint()->GetPosition()));
+                position.setZ(position.z() - record_.front - record_.depth);
+                record_.voxels[std::make_tuple(int(std::floor(position.x() / VOXEL_XY)),
+                                               int(std::floor(position.y() / VOXEL_XY)),
+                                               int(std::floor(position.z() / VOXEL_Z)))] += edep;
+            }
+
+        private:
+
+            ShowerRecord& record_;
+    };
+
+    /**
+     * Writes the shower of each event to the library tree.
+     */
+    class FrozenShowerEvent : public G4UserEventAction {
+
+        public:
+
+            FrozenShowerEvent(ShowerRecord& record, TTree* tree) : record_(record) {
+                tree_ = tree;
+                tree_->Branch("pdg", &record_.pdg);
+                tree_->Branch("energy", &record_.energy);
+                tree_->Branch("depth", &record_.depth);
+                tree_->Branch("x", &x_);
+                tree_->Branch("y", &y_);
+                tree_->Branch("z", &z_);
+                tree_->Branch("e", &e_);
+            }
+
+            void BeginOfEventAction(const G4Event*) {
+                record_.voxels.clear();
+            }
+
+            void EndOfEventAction(const G4Event*) {
+                x_.clear();
+                y_.clear();
+                z_.clear();
+                e_.clear();
+                for (const auto& voxel : record_.voxels) {
+                    x_.push_back((std::get<0>(voxel.first) + 0.5) * VOXEL_XY);
+                    y_.push_back((std::get<1>(voxel.first) + 0.5) * VOXEL_XY);
+                    z_.push_back((std::get<2>(voxel.first) + 0.5) * VOXEL_Z);
+                    e_.push_back(voxel.second);
+                }
+                tree_->Fill();
+            }
+
+        private:
+
+            ShowerRecord& record_;
+            TTree* tree_;
+            std::vector<float> x_, y_, z_, e_;
+    };
+
+    /**
+     * Find a logical volume and the transform from global coordinates to its frame.
+     * @return The volume or nullptr if it was not found below the given physical volume.
+     */
+    G4LogicalVolume* findEnvelope(G4VPhysicalVolume* pv, const std::string& name, const G4AffineTransform& toMother, G4AffineTransform& toEnvelope) {
+        G4AffineTransform toLocal = toMother * G4AffineTransform(pv->GetRotation(), pv->GetTranslation()).Inverse();
+        if (pv->GetLogicalVolume()->GetName() == name) {
+            toEnvelope = toLocal;
+            return pv->GetLogicalVolume();
+        }
+        for (int iDaughter = 0; iDaughter < pv->GetLogicalVolume()->GetNoDaughters(); ++iDaughter) {
+            G4LogicalVolume* envelope = findEnvelope(pv->GetLogicalVolume()->GetDaughter(iDaughter), name, toLocal, toEnvelope);
+            if (envelope) {
+                return envelope;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Parse comma separated bin edges.
+     */
+    std::vector<double> parseEdges(const std::string& edges) {
+        std::vector<double> values;
+        std::stringstream stream(edges);
+        std::string value;
+        while (std::getline(stream, value, ',')) {
+            values.push_back(std::atof(value.c_str()));
+        }
+        return values;
+    }
+
+    void usage() {
+        std::cout << "Usage: ldmx-frozen-showers detector.gdml library.root [options]" << std::endl;
+        std::cout << "  -n showers          Showers per particle, energy and depth bin (default 100)" << std::endl;
+        std::cout << "  -e e0,e1,...        Energy bin edges in MeV (default 0,5,10,20,35,50,75,100)" << std::endl;
+        std::cout << "  -d d0,d1,...        Depth bin edges in mm (default 0,10,20,40,60,80,120,160,200)" << std::endl;
+        std::cout << "  -v envelope         Logical volume enclosing the ECal (default em_calorimeters)" << std::endl;
+        std::cout << "  -s seed             Random seed (default 1)" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+
+    if (argc < 3) {
+        usage();
+        return 1;
+    }
+
+    std::string detector = argv[1];
+    std::string output = argv[2];
+    int nShowers = 100;
+    std::vector<double> energyEdges = {0, 5, 10, 20, 35, 50, 75, 100};
+    std::vector<double> depthEdges = {0, 10, 20, 40, 60, 80, 120, 160, 200};
+    std::string envelope = "em_calorimeters";
+    long seed = 1;
+
+    for (int iArg = 3; iArg + 1 < argc; iArg += 2) {
+        std::string option = argv[iArg];
+        if (option == "-n") nShowers = std::atoi(argv[iArg + 1]);
+        else if (option == "-e") energyEdges = parseEdges(argv[iArg + 1]);
+        else if (option == "-d") depthEdges = parseEdges(argv[iArg + 1]);
+        else if (option == "-v") envelope = argv[iArg + 1];
+        else if (option == "-s") seed = std::atol(argv[iArg + 1]);
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if (energyEdges.size() < 2 || depthEdges.size() < 2) {
+        usage();
+        return 1;
+    }
+
+    CLHEP::HepRandom::setTheSeed(seed);
+
+    G4RunManager* runManager = new G4RunManager;
+    G4GDMLParser* parser = new G4GDMLParser;
+    parser->Read(detector);
+    runManager->SetUserInitialization(new DetectorConstruction(parser));
+    runManager->SetUserInitialization(RunManager::createPhysicsList(false));
+
+    TFile file(output.c_str(), "RECREATE");
+    TTree* tree = new TTree(EcalFrozenShowerLibrary::TREE_NAME.c_str(), "ECal frozen showers");
+
+    ShowerRecord record;
+    FrozenShowerGun* gun = new FrozenShowerGun(record);
+    runManager->SetUserAction(gun);
+    runManager->SetUserAction(new FrozenShowerStepping(record));
+    runManager->SetUserAction(new FrozenShowerEvent(record, tree));
+    runManager->Initialize();
+
+    G4VPhysicalVolume* world = G4TransportationManager::GetTransportationManager()->GetNavigatorForTracking()->GetWorldVolume();
+    G4LogicalVolume* envelopeVolume = findEnvelope(world, envelope, G4AffineTransform(), record.toEnvelope);
+    if (!envelopeVolume) {
+        std::cerr << "[ ldmx-frozen-showers ] : The envelope volume " << envelope << " was not found." << std::endl;
+        return 1;
+    }
+    record.front = envelopeVolume->GetSolid()->GetExtent().GetZmin();
+
+    for (int pdg : {11, -11, 22}) {
+        for (std::size_t iEnergy = 0; iEnergy + 1 < energyEdges.size(); ++iEnergy) {
+            for (std::size_t iDepth = 0; iDepth + 1 < depthEdges.size(); ++iDepth) {
+                std::cout << "[ ldmx-frozen-showers ] : Recording " << nShowers << " showers of " << pdg
+                          << " in [" << energyEdges[iEnergy] << ", " << energyEdges[iEnergy + 1] << ") MeV and ["
+                          << depthEdges[iDepth] << ", " << depthEdges[iDepth + 1] << ") mm" << std::endl;
+                gun->setBin(pdg, std::max(energyEdges[iEnergy], 0.1) * MeV, energyEdges[iEnergy + 1] * MeV,
+                        depthEdges[iDepth] * mm, depthEdges[iDepth + 1] * mm);
+                runManager->BeamOn(nShowers);
+            }
+        }
+    }
+
+    TVectorD energyBins(energyEdges.size(), energyEdges.data());
+    TVectorD depthBins(depthEdges.size(), depthEdges.data());
+    file.cd();
+    energyBins.Write(EcalFrozenShowerLibrary::ENERGY_BINS_NAME.c_str());
+    depthBins.Write(EcalFrozenShowerLibrary::DEPTH_BINS_NAME.c_str());
+    tree->Write();
+    file.Close();
+
+    delete runManager;
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file ProcessCache.h
+ * @brief Class which caches the name and type of each Geant4 process
+ * @author Omar Moreno, SLAC National Accelerator Laboratory
+ */
+#ifndef SIMCORE_PROCESSCACHE_H_
+#define SIMCORE_PROCESSCACHE_H_
+
+#include "G4VProcess.hh"
+
+#include <string>
+#include <unordered_map>
+
+namespace ldmx {
+
+    /**
+     * @class ProcessCache
+     * @brief Maps each G4VProcess to its name and type 
+     *
+     * @note
+     * The cache is filled from the process table once the processes of the 
+     * physics list are constructed, so looking up the creator process of a 
+     * track is a single hash lookup instead of string parsing.  Both the name
+     * reported by Geant4 and the name with any biasing wrapper removed are 
+     * kept e.g. "biasWrapper(photonNuclear)" and "photonNuclear".  Processes 
+     * belong to a thread, so there is one cache per thread.
+     */
+    class ProcessCache {
+
+        public:
+
+            /**
+             * Function used to get the process type from the process name.
+             */
+            typedef int (*TypeFunction)(const std::string&);
+
+            /**
+             * Cached information about a process.
+             */
+            struct Entry {
+
+                /** The process name with any biasing wrapper removed. */
+                std::string name;
+
+                /** The process name as reported by Geant4. */
+                std::string fullName;
+
+                /** The process type. */
+                int type;
+            };
+
+            /**
+             * Get the cache of the current thread.
+             * @return The process cache.
+             */
+            static ProcessCache* getInstance();
+
+            /**
+             * Fill the cache from the process table.
+             * @param typeFunction The function giving the type from a process name.
+             */
+            void build(TypeFunction typeFunction);
+
+            /**
+             * Get the cached information for a process, adding it to the cache 
+             * if it was created after the cache was built.
+             * @param process The process.
+             * @return The cached information.
+             */
+            const Entry& get(const G4VProcess* process) {
+                auto it = entries_.find(process);
+                if (it != entries_.end()) {
+                    return it->second;
+                }
+                return add(process);
+            }
+
+            /**
+             * Get the type of a process.
+             * @param process The process.
+             * @return The process type.
+             */
+            int getType(const G4VProcess* process) {
+                return get(process).type;
+            }
+
+            /**
+             * Get the name of a process without any biasing wrapper.
+             * @param process The process.
+             * @return The process name.
+             */
+            const std::string& getName(const G4VProcess* process) {
+                return get(process).name;
+            }
+
+            /**
+             * Get the name of a process as reported by Geant4, including any
+             * biasing wrapper.
+             * @param process The process.
+             * @return The process name.
+             */
+            const std::string& getFullName(const G4VProcess* process) {
+                return get(process).fullName;
+            }
+
+            /**
+             * Remove the biasing wrapper from a process name.
+             * @param processName The process name.
+             * @return The name of the wrapped process or the name itself.
+             */
+            static std::string unwrapName(const std::string& processName);
+
+        private:
+
+            /**
+             * Add a process to the cache.
+             * @param process The process.
+             * @return The cached information.
+             */
+            const Entry& add(const G4VProcess* process);
+
+        private:
+
+            /** Map of processes to their cached information. */
+            std::unordered_map<const G4VProcess*, Entry> entries_;
+
+            /** Function giving the type from a process name. */
+            TypeFunction typeFunction_{nullptr};
+    };
+
+}
+
+#endif
@@ -303,7 +303,7 @@ namespace ldmx {
             }
 
             bool passes(const G4Track* aTrack) {
-                static G4TrackingManager* mgr = G4RunManagerKernel::GetRunManagerKernel()->GetTrackingManager();
+                G4TrackingManager* mgr = G4RunManagerKernel::GetRunManagerKernel()->GetTrackingManager();
                 if (aTrack != mgr->GetTrack()) {
                     return false;
                 }
@@ -0,0 +1,44 @@
+#include "SimCore/ProcessCache.h"
+
+// Geant4
+#include "G4ProcessTable.hh"
+#include "G4ProcessVector.hh"
+
+namespace ldmx {
+
+    ProcessCache* ProcessCache::getInstance() {
+        static G4ThreadLocal ProcessCache* instance = nullptr;
+        if (!instance) {
+            instance = new ProcessCache;
+        }
+        return instance;
+    }
+
+    void ProcessCache::build(TypeFunction typeFunction) {
+        typeFunction_ = typeFunction;
+        entries_.clear();
+
+        G4ProcessVector* processes = G4ProcessTable::GetProcessTable()->FindProcesses();
+        for (int iProcess = 0; iProcess < processes->size(); iProcess++) {
+            add((*processes)[iProcess]);
+        }
+        delete processes;
+    }
+
+    const ProcessCache::Entry& ProcessCache::add(const G4VProcess* process) {
+        Entry& entry = entries_[process];
+        entry.fullName = process->GetProcessName();
+        entry.name = unwrapName(entry.fullName);
+        entry.type = typeFunction_ ? typeFunction_(entry.name) : 0;
+        return entry;
+    }
+
+    std::string ProcessCache::unwrapName(const std::string& processName) {
+        if (processName.find("biasWrapper") != std::string::npos) { 
+            std::size_t pos = processName.find_first_of("(") + 1;
+            return processName.substr(pos, processName.size() - pos - 1); 
+        }
+        return processName;
+    }
+
+}
@@ -42,7 +42,7 @@ namespace ldmx {
         protected:
 
             /* The plugin manager pointer; allow protected access for convenience of sub-classes. */
-            PluginManager* pluginManager_;
+            PluginManager* pluginManager_{nullptr};
     };
 
 }
@@ -20,6 +20,7 @@ class TClonesArray;
 namespace ldmx {
 
     // Forward declaration for classes inside ldmx namespace
+    class Event;
     class FindableTrackResult; 
     class SimParticle;
 
@@ -61,6 +62,36 @@ namespace ldmx {
 
         void printDaughters(const SimParticle* particle, std::string prefix = ""); 
 
+        /**
+         * Tag used to retrieve the recoil electron from the per-event cache
+         * via Event::getDerived.  The search is performed on the
+         * 'SimParticles' collection.
+         */
+        struct RecoilElectron {
+            typedef const SimParticle* value_type;
+            static value_type compute(const Event& event);
+        };
+
+        /**
+         * Tag used to retrieve the gamma that underwent a photo-nuclear 
+         * reaction from the per-event cache via Event::getDerived.  The
+         * value is null if the PN gamma could not be found.
+         */
+        struct PNGamma {
+            typedef const SimParticle* value_type;
+            static value_type compute(const Event& event);
+        };
+
+        /**
+         * Tag used to retrieve the maps of findable tracks built from the
+         * 'FindableTracks' collection from the per-event cache via
+         * Event::getDerived.  The collection must exist in the event.
+         */
+        struct FindableTrackMaps {
+            typedef TrackMaps value_type;
+            static value_type compute(const Event& event);
+        };
+
 
     } // Analysis
 
@@ -14,6 +14,7 @@
 //----------//
 //   ldmx   //
 //----------//
+#include "Event/Event.h"
 #include "Event/FindableTrackResult.h"
 #include "Event/SimParticle.h"
 
@@ -29,31 +30,25 @@ namespace ldmx {
 
         const SimParticle* searchForRecoil(const TClonesArray* particles, const int index) { 
 
-            // Check that the index is within the bounds of the array. If not, 
-            // throw an exception.
-            if (index == particles->GetEntriesFast()) 
-                throw std::out_of_range("Index is beyond the size of the TClonesArray."); 
-
-            const SimParticle* particle = static_cast<const SimParticle*>(particles->At(index));
-
-            if ((particle->getPdgID() == 11) && (particle->getGenStatus() == 1)) return particle;
+            for (int iparticle{index}; iparticle < particles->GetEntriesFast(); ++iparticle) { 
+                const SimParticle* particle = static_cast<const SimParticle*>(particles->At(iparticle));
+                if ((particle->getPdgID() == 11) && (particle->getGenStatus() == 1)) return particle;
+            }
 
-            return searchForRecoil(particles, index + 1); 
+            // The recoil wasn't found before reaching the end of the array.
+            throw std::out_of_range("Index is beyond the size of the TClonesArray."); 
         }
 
         const SimParticle* searchForPNGamma(const SimParticle* particle, const int index) { 
 
-            // Check that the index is within the bounds of the array. If not, 
-            // throw an exception.
-            if (index == particle->getDaughterCount()) return nullptr; 
-                //throw std::out_of_range("Index is beyond the size of the TClonesArray.");
-
-            const SimParticle* daughter = particle->getDaughter(index);
-            if ((daughter->getDaughterCount() > 0) 
-                    && (daughter->getDaughter(0)->getProcessType() 
-                        == SimParticle::ProcessType::photonNuclear)) return daughter;
+            for (int idaughter{index}; idaughter < particle->getDaughterCount(); ++idaughter) { 
+                const SimParticle* daughter = particle->getDaughter(idaughter);
+                if ((daughter->getDaughterCount() > 0) 
+                        && (daughter->getDaughter(0)->getProcessType() 
+                            == SimParticle::ProcessType::photonNuclear)) return daughter;
+            }
 
-            return searchForPNGamma(particle, index + 1);  
+            return nullptr; 
         }
 
         TrackMaps getFindableTrackMaps(const TClonesArray* tracks) { 
@@ -74,6 +69,18 @@ namespace ldmx {
             return map;  
         }
 
+        RecoilElectron::value_type RecoilElectron::compute(const Event& event) { 
+            return searchForRecoil(event.getCollection("SimParticles")); 
+        }
+
+        PNGamma::value_type PNGamma::compute(const Event& event) { 
+            return searchForPNGamma(event.getDerived<RecoilElectron>()); 
+        }
+
+        FindableTrackMaps::value_type FindableTrackMaps::compute(const Event& event) { 
+            return getFindableTrackMaps(event.getCollection("FindableTracks")); 
+        }
+
         void printDaughters(const SimParticle* particle, std::string prefix) {
 
             std::cout << prefix << ">>>>>>>>> Daughters of PDG ID: " << particle->getPdgID() 
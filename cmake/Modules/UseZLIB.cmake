@@ -0,0 +1,4 @@
+# find zlib for reading gzip compressed input files
+find_package(ZLIB REQUIRED)
+set(EXT_DEP_INCLUDE_DIRS ${EXT_DEP_INCLUDE_DIRS} ${ZLIB_INCLUDE_DIRS})
+set(EXT_DEP_LIBRARIES ${EXT_DEP_LIBRARIES} ${ZLIB_LIBRARIES})